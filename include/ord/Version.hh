@@ -0,0 +1,5 @@
+#define OPENROAD_VERSION "fc84adb9e4cd82dc0d9b747a3d7530d7f6ecc021"
+
+#define OPENROAD_GIT_DESCRIBE ""
+
+/* #undef BUILD_OPENPHYSYN */
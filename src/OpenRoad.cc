@@ -314,6 +314,7 @@ void OpenRoad::readDef(const char* filename,
   if (continue_on_errors) {
     def_reader.continueOnErrors();
   }
+  def_reader.setThreadCount(threads_);
   dbBlock* block = nullptr;
   if (child) {
     auto parent = db_->getChip()->getBlock();
@@ -362,6 +363,7 @@ void OpenRoad::writeDef(const char* filename, const string& version)
     if (block) {
       odb::defout def_writer(logger_);
       def_writer.setVersion(stringToDefVersion(version));
+      def_writer.setThreadCount(threads_);
       def_writer.writeBlock(block, filename);
     }
   }
@@ -32,10 +32,13 @@
 #pragma once
 
 #include <map>
+#include <mutex>
 #include <queue>
+#include <unordered_map>
 #include <unordered_set>
 
 #include "odb/db.h"
+#include "odb/dbBlockCallBackObj.h"
 #include "odb/dbWireGraph.h"
 #include "utl/Logger.h"
 
@@ -53,6 +56,7 @@ struct AntennaModel;
 
 ///////////////////////////////////////
 struct GraphNode;
+struct PinType;
 
 struct NodeInfo
 {
@@ -119,18 +123,18 @@ struct Violation
 };
 
 using LayerToNodeInfo = std::map<odb::dbTechLayer*, NodeInfo>;
-using GraphNodes = std::vector<GraphNode*>;
+using GraphNodes = std::vector<GraphNode>;
 using LayerToGraphNodes = std::unordered_map<odb::dbTechLayer*, GraphNodes>;
 using GateToLayerToNodeInfo = std::map<std::string, LayerToNodeInfo>;
 using Violations = std::vector<Violation>;
 using GateToViolationLayers
     = std::unordered_map<std::string, std::unordered_set<odb::dbTechLayer*>>;
 
-class AntennaChecker
+class AntennaChecker : public odb::dbBlockCallBackObj
 {
  public:
   AntennaChecker();
-  ~AntennaChecker();
+  ~AntennaChecker() override;
 
   void init(odb::dbDatabase* db,
             GlobalRouteSource* global_route_source,
@@ -147,6 +151,13 @@ class AntennaChecker
   void initAntennaRules();
   void setReportFileName(const char* file_name);
 
+  // from dbBlockCallBackObj, invalidate the cached net results
+  void inDbInstSwapMasterAfter(odb::dbInst* inst) override;
+  void inDbPostMoveInst(odb::dbInst* inst) override;
+  void inDbNetDestroy(odb::dbNet* net) override;
+  void inDbITermPostDisconnect(odb::dbITerm* iterm, odb::dbNet* net) override;
+  void inDbITermPostConnect(odb::dbITerm* iterm) override;
+
  private:
   bool haveRoutedNets();
   double getPwlFactor(odb::dbTechLayerAntennaRule::pwl_pair pwl_info,
@@ -160,7 +171,13 @@ class AntennaChecker
   std::vector<std::pair<double, std::vector<odb::dbITerm*>>>
   getViolatedWireLength(odb::dbNet* net, int routing_level);
   bool isValidGate(odb::dbMTerm* mterm);
-  void buildLayerMaps(odb::dbNet* net, LayerToGraphNodes& node_by_layer_map);
+  void buildLayerMaps(odb::dbNet* net,
+                      LayerToGraphNodes& node_by_layer_map,
+                      std::vector<PinType>& pins);
+  std::size_t wireHash(odb::dbWire* wire) const;
+  GateToLayerToNodeInfo getGateInfo(odb::dbNet* db_net, odb::dbWire* wire);
+  void invalidateNet(odb::dbNet* net);
+  void invalidateInst(odb::dbInst* inst);
   void checkNet(odb::dbNet* net,
                 bool verbose,
                 bool report_if_no_violation,
@@ -172,8 +189,10 @@ class AntennaChecker
                 Violations& antenna_violations);
   void saveGates(odb::dbNet* db_net,
                  LayerToGraphNodes& node_by_layer_map,
-                 int node_count);
+                 int node_count,
+                 std::vector<PinType>& pins);
   void calculateAreas(const LayerToGraphNodes& node_by_layer_map,
+                      const std::vector<PinType>& pins,
                       GateToLayerToNodeInfo& gate_info);
   void calculatePAR(GateToLayerToNodeInfo& gate_info);
   void calculateCAR(GateToLayerToNodeInfo& gate_info);
@@ -228,6 +247,18 @@ class AntennaChecker
   std::string report_file_name_;
   odb::dbTechLayer* min_layer_;
   std::vector<odb::dbNet*> nets_;
+
+  // Areas and ratios of the gates of each checked net, reused while the
+  // wire is unchanged and no gate moves or connects.  There is one entry
+  // per checked net and entries go with their net, so the cache is bounded
+  // by the block's net count and needs no eviction.
+  struct NetGateInfo
+  {
+    std::size_t wire_hash;
+    GateToLayerToNodeInfo gate_info;
+  };
+  std::unordered_map<odb::dbNet*, NetGateInfo> net_gate_info_;
+  std::mutex net_gate_info_mutex_;
   // consts
   static constexpr int max_diode_count_per_gate = 10;
 };
@@ -34,6 +34,7 @@
 #include <omp.h>
 #include <tcl.h>
 
+#include <boost/functional/hash.hpp>
 #include <boost/pending/disjoint_sets.hpp>
 #include <cstdio>
 #include <cstring>
@@ -99,7 +100,13 @@ void AntennaChecker::init(odb::dbDatabase* db,
 void AntennaChecker::initAntennaRules()
 {
   block_ = db_->getChip()->getBlock();
+  if (!hasOwner()) {
+    // new block or the previous one was destroyed
+    net_gate_info_.clear();
+    addOwner(block_);
+  }
   odb::dbTech* tech = db_->getTech();
+  min_layer_ = tech->findRoutingLayer(1);
   for (odb::dbTechLayer* tech_layer : tech->getLayers()) {
     double metal_factor = 1.0;
     double diff_metal_factor = 1.0;
@@ -220,18 +227,16 @@ double AntennaChecker::getPwlFactor(
 
 void AntennaChecker::saveGates(odb::dbNet* db_net,
                                LayerToGraphNodes& node_by_layer_map,
-                               const int node_count)
+                               const int node_count,
+                               std::vector<PinType>& pins)
 {
-  std::unordered_map<PinType, std::vector<int>, PinTypeHash> pin_nbrs;
+  // node ids touched by each pin, indexed like pins
+  std::vector<std::vector<int>> pin_nbrs;
   std::vector<int> ids;
   // iterate all instance pins
   for (odb::dbITerm* iterm : db_net->getITerms()) {
     odb::dbMTerm* mterm = iterm->getMTerm();
-    std::string pin_name = fmt::format("  {}/{} ({})",
-                                       iterm->getInst()->getConstName(),
-                                       mterm->getConstName(),
-                                       mterm->getMaster()->getConstName());
-    PinType pin = PinType(pin_name, iterm);
+    std::vector<int> nbrs;
     odb::dbInst* inst = iterm->getInst();
     const odb::dbTransform transform = inst->getTransform();
     for (odb::dbMPin* mterm : mterm->getMPins()) {
@@ -249,51 +254,72 @@ void AntennaChecker::saveGates(odb::dbNet* db_net,
         // convert rect -> polygon
         Polygon pin_pol = rectToPolygon(pin_rect);
         // if has wire on same layer connect to pin
-        ids = findNodesWithIntersection(node_by_layer_map[tech_layer], pin_pol);
+        const GraphNodes& layer_nodes = node_by_layer_map[tech_layer];
+        ids = findNodesWithIntersection(layer_nodes, pin_pol);
         for (const int& index : ids) {
-          pin_nbrs[pin].push_back(node_by_layer_map[tech_layer][index]->id);
+          nbrs.push_back(layer_nodes[index].id);
         }
         // if has via on upper layer connected to pin
         if (upper_layer) {
-          ids = findNodesWithIntersection(node_by_layer_map[upper_layer],
-                                          pin_pol);
+          const GraphNodes& upper_nodes = node_by_layer_map[upper_layer];
+          ids = findNodesWithIntersection(upper_nodes, pin_pol);
           for (const int& index : ids) {
-            pin_nbrs[pin].push_back(node_by_layer_map[upper_layer][index]->id);
+            nbrs.push_back(upper_nodes[index].id);
           }
         }
         // if has via on lower layer connected to pin
         if (lower_layer) {
-          ids = findNodesWithIntersection(node_by_layer_map[lower_layer],
-                                          pin_pol);
+          const GraphNodes& lower_nodes = node_by_layer_map[lower_layer];
+          ids = findNodesWithIntersection(lower_nodes, pin_pol);
           for (const int& index : ids) {
-            pin_nbrs[pin].push_back(node_by_layer_map[lower_layer][index]->id);
+            nbrs.push_back(lower_nodes[index].id);
           }
         }
       }
     }
+    if (!nbrs.empty()) {
+      std::string pin_name = fmt::format("  {}/{} ({})",
+                                         inst->getConstName(),
+                                         mterm->getConstName(),
+                                         mterm->getMaster()->getConstName());
+      pins.emplace_back(std::move(pin_name), iterm);
+      pin_nbrs.push_back(std::move(nbrs));
+    }
   }
+
+  // The scratch vectors are reused by every net checked on this thread.
+  thread_local static std::vector<int> dsu_parent;
+  thread_local static std::vector<int> dsu_size;
+  // pins reaching each dsu root, filled per layer
+  thread_local static std::vector<std::vector<int>> root_pins;
+  thread_local static std::vector<int> used_roots;
+
   // run DSU from min_layer to max_layer
-  std::vector<int> dsu_parent(node_count);
-  std::vector<int> dsu_size(node_count);
+  dsu_parent.resize(node_count);
+  dsu_size.resize(node_count);
   for (int i = 0; i < node_count; i++) {
     dsu_size[i] = 1;
     dsu_parent[i] = i;
   }
+  if (root_pins.size() < static_cast<size_t>(node_count)) {
+    root_pins.resize(node_count);
+  }
 
-  boost::disjoint_sets<int*, int*> dsu(&dsu_size[0], &dsu_parent[0]);
+  boost::disjoint_sets<int*, int*> dsu(dsu_size.data(), dsu_parent.data());
 
   odb::dbTechLayer* iter = min_layer_;
   odb::dbTechLayer* lower_layer;
   while (iter) {
+    GraphNodes& layer_nodes = node_by_layer_map[iter];
     // iterate each node of this layer to union set
-    for (auto& node_it : node_by_layer_map[iter]) {
-      int id_u = node_it->id;
-      // if has lower layer
-      lower_layer = iter->getLowerLayer();
-      if (lower_layer) {
+    lower_layer = iter->getLowerLayer();
+    if (lower_layer) {
+      const GraphNodes& lower_nodes = node_by_layer_map[lower_layer];
+      for (const auto& node : layer_nodes) {
+        int id_u = node.id;
         // get lower neighbors and union
-        for (const int& lower_it : node_it->low_adj) {
-          int id_v = node_by_layer_map[lower_layer][lower_it]->id;
+        for (const int& lower_it : node.low_adj) {
+          int id_v = lower_nodes[lower_it].id;
           // if they are on different sets then union
           if (dsu.find_set(id_u) != dsu.find_set(id_v)) {
             dsu.union_set(id_u, id_v);
@@ -301,18 +327,30 @@ void AntennaChecker::saveGates(odb::dbNet* db_net,
         }
       }
     }
-    for (auto& node_it : node_by_layer_map[iter]) {
-      int id_u = node_it->id;
-      // check gates in same set (first Nodes x gates)
-      for (const auto& gate_it : pin_nbrs) {
-        for (const int& nbr_id : gate_it.second) {
-          if (dsu.find_set(id_u) == dsu.find_set(nbr_id)) {
-            node_it->gates.insert(gate_it.first);
-            break;
-          }
+    if (layer_nodes.empty()) {
+      iter = iter->getUpperLayer();
+      continue;
+    }
+    // collect the pins of each set once, instead of comparing every node
+    // with every pin neighbor
+    for (int pin = 0; pin < static_cast<int>(pin_nbrs.size()); pin++) {
+      for (const int& nbr_id : pin_nbrs[pin]) {
+        std::vector<int>& root = root_pins[dsu.find_set(nbr_id)];
+        if (root.empty()) {
+          used_roots.push_back(dsu.find_set(nbr_id));
+        }
+        if (root.empty() || root.back() != pin) {
+          root.push_back(pin);
         }
       }
     }
+    for (auto& node : layer_nodes) {
+      node.gates = root_pins[dsu.find_set(node.id)];
+    }
+    for (const int& root : used_roots) {
+      root_pins[root].clear();
+    }
+    used_roots.clear();
     iter = iter->getUpperLayer();
   }
 }
@@ -406,19 +444,23 @@ void AntennaChecker::calculateViaPar(odb::dbTechLayer* tech_layer,
 }
 
 void AntennaChecker::calculateAreas(const LayerToGraphNodes& node_by_layer_map,
+                                    const std::vector<PinType>& pins,
                                     GateToLayerToNodeInfo& gate_info)
 {
   for (const auto& it : node_by_layer_map) {
     for (const auto& node_it : it.second) {
+      if (node_it.gates.empty()) {
+        continue;
+      }
       NodeInfo info;
-      double area = gtl::area(node_it->pol);
+      double area = gtl::area(node_it.pol);
       // convert from dbu^2 to microns^2
       area = block_->dbuToMicrons(area);
       area = block_->dbuToMicrons(area);
       info.area = area;
       int gates_count = 0;
-      std::vector<odb::dbITerm*> iterms;
-      for (const auto& gate : node_it->gates) {
+      for (const int& gate_index : node_it.gates) {
+        const PinType& gate = pins[gate_index];
         if (!gate.isITerm) {
           continue;
         }
@@ -436,11 +478,12 @@ void AntennaChecker::calculateAreas(const LayerToGraphNodes& node_by_layer_map,
         uint wire_thickness_dbu = 0;
         it.first->getThickness(wire_thickness_dbu);
         double wire_thickness = block_->dbuToMicrons(wire_thickness_dbu);
-        info.side_area = block_->dbuToMicrons(gtl::perimeter(node_it->pol)
+        info.side_area = block_->dbuToMicrons(gtl::perimeter(node_it.pol)
                                               * wire_thickness);
       }
       // put values on struct
-      for (const auto& gate : node_it->gates) {
+      for (const int& gate_index : node_it.gates) {
+        const PinType& gate = pins[gate_index];
         if (!gate.isITerm) {
           continue;
         }
@@ -938,7 +981,8 @@ int AntennaChecker::checkGates(odb::dbNet* db_net,
 }
 
 void AntennaChecker::buildLayerMaps(odb::dbNet* db_net,
-                                    LayerToGraphNodes& node_by_layer_map)
+                                    LayerToGraphNodes& node_by_layer_map,
+                                    std::vector<PinType>& pins)
 {
   odb::dbWire* wires = db_net->getWire();
 
@@ -948,15 +992,13 @@ void AntennaChecker::buildLayerMaps(odb::dbNet* db_net,
   avoidPinIntersection(db_net, set_by_layer);
 
   // init struct (copy polygon set information on struct to save neighbors)
-  odb::dbTech* tech = db_->getTech();
-  min_layer_ = tech->findRoutingLayer(1);
-
   int node_count = 0;
   for (const auto& layer_it : set_by_layer) {
+    GraphNodes& layer_nodes = node_by_layer_map[layer_it.first];
+    layer_nodes.reserve(layer_it.second.size());
+    const bool isVia = layer_it.first->getRoutingLevel() == 0;
     for (const auto& pol_it : layer_it.second) {
-      bool isVia = layer_it.first->getRoutingLevel() == 0;
-      node_by_layer_map[layer_it.first].push_back(
-          new GraphNode(node_count, isVia, pol_it));
+      layer_nodes.emplace_back(node_count, isVia, pol_it);
       node_count++;
     }
   }
@@ -977,7 +1019,7 @@ void AntennaChecker::buildLayerMaps(odb::dbNet* db_net,
           // connect upper -> via
           for (int& up_index : upper_index) {
             node_by_layer_map[layer_it.first->getUpperLayer()][up_index]
-                ->low_adj.push_back(via_index);
+                .low_adj.push_back(via_index);
           }
         } else if (upper_index.size() > 2) {
           std::string log_error = fmt::format(
@@ -991,7 +1033,7 @@ void AntennaChecker::buildLayerMaps(odb::dbNet* db_net,
         if (lower_index.size() == 1) {
           // connect via -> lower
           for (int& low_index : lower_index) {
-            node_by_layer_map[layer_it.first][via_index]->low_adj.push_back(
+            node_by_layer_map[layer_it.first][via_index].low_adj.push_back(
                 low_index);
           }
         } else if (lower_index.size() > 2) {
@@ -1007,7 +1049,86 @@ void AntennaChecker::buildLayerMaps(odb::dbNet* db_net,
       }
     }
   }
-  saveGates(db_net, node_by_layer_map, node_count);
+  saveGates(db_net, node_by_layer_map, node_count, pins);
+}
+
+std::size_t AntennaChecker::wireHash(odb::dbWire* wire) const
+{
+  std::vector<int> data;
+  std::vector<unsigned char> op_codes;
+  wire->getRawWireData(data, op_codes);
+
+  std::size_t hash = boost::hash_range(data.begin(), data.end());
+  boost::hash_combine(hash,
+                      boost::hash_range(op_codes.begin(), op_codes.end()));
+  return hash;
+}
+
+GateToLayerToNodeInfo AntennaChecker::getGateInfo(odb::dbNet* db_net,
+                                                  odb::dbWire* wire)
+{
+  const std::size_t wire_hash = wireHash(wire);
+  {
+    std::lock_guard<std::mutex> lock(net_gate_info_mutex_);
+    auto cached = net_gate_info_.find(db_net);
+    if (cached != net_gate_info_.end()
+        && cached->second.wire_hash == wire_hash) {
+      return cached->second.gate_info;
+    }
+  }
+
+  LayerToGraphNodes node_by_layer_map;
+  std::vector<PinType> pins;
+  GateToLayerToNodeInfo gate_info;
+  buildLayerMaps(db_net, node_by_layer_map, pins);
+
+  calculateAreas(node_by_layer_map, pins, gate_info);
+
+  calculatePAR(gate_info);
+  calculateCAR(gate_info);
+
+  std::lock_guard<std::mutex> lock(net_gate_info_mutex_);
+  net_gate_info_[db_net] = {wire_hash, gate_info};
+  return gate_info;
+}
+
+void AntennaChecker::invalidateNet(odb::dbNet* net)
+{
+  if (net != nullptr) {
+    net_gate_info_.erase(net);
+  }
+}
+
+void AntennaChecker::invalidateInst(odb::dbInst* inst)
+{
+  for (odb::dbITerm* iterm : inst->getITerms()) {
+    invalidateNet(iterm->getNet());
+  }
+}
+
+void AntennaChecker::inDbInstSwapMasterAfter(odb::dbInst* inst)
+{
+  invalidateInst(inst);
+}
+
+void AntennaChecker::inDbPostMoveInst(odb::dbInst* inst)
+{
+  invalidateInst(inst);
+}
+
+void AntennaChecker::inDbNetDestroy(odb::dbNet* net)
+{
+  invalidateNet(net);
+}
+
+void AntennaChecker::inDbITermPostDisconnect(odb::dbITerm*, odb::dbNet* net)
+{
+  invalidateNet(net);
+}
+
+void AntennaChecker::inDbITermPostConnect(odb::dbITerm* iterm)
+{
+  invalidateNet(iterm->getNet());
 }
 
 void AntennaChecker::checkNet(odb::dbNet* db_net,
@@ -1022,14 +1143,7 @@ void AntennaChecker::checkNet(odb::dbNet* db_net,
 {
   odb::dbWire* wire = db_net->getWire();
   if (wire) {
-    LayerToGraphNodes node_by_layer_map;
-    GateToLayerToNodeInfo gate_info;
-    buildLayerMaps(db_net, node_by_layer_map);
-
-    calculateAreas(node_by_layer_map, gate_info);
-
-    calculatePAR(gate_info);
-    calculateCAR(gate_info);
+    GateToLayerToNodeInfo gate_info = getGateInfo(db_net, wire);
 
     int pin_violations = checkGates(db_net,
                                     verbose,
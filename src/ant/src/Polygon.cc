@@ -55,10 +55,16 @@ std::vector<int> findNodesWithIntersection(const GraphNodes& graph_nodes,
   obj += pol;
   obj += 1;
   Polygon& scaled_pol = obj[0];
+  Rectangle scaled_box;
+  gtl::extents(scaled_box, scaled_pol);
   int index = 0;
   std::vector<int> ids;
   for (const auto& node : graph_nodes) {
-    if (gtl::area(node->pol & scaled_pol) > 0) {
+    Rectangle node_box;
+    gtl::extents(node_box, node.pol);
+    // skip the polygon boolean when the bounding boxes don't overlap
+    if (gtl::intersects(node_box, scaled_box, false)
+        && gtl::area(node.pol & scaled_pol) > 0) {
       ids.push_back(index);
     }
     index++;
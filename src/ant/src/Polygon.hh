@@ -46,13 +46,18 @@ using Polygon = gtl::polygon_90_data<int>;
 using PolygonSet = std::vector<Polygon>;
 using Point = gtl::polygon_traits<Polygon>::point_type;
 
+using Rectangle = gtl::rectangle_data<int>;
+
+// Nodes are stored by value in the per layer vectors of a LayerToGraphNodes;
+// low_adj holds indices into the lower layer vector and gates holds indices
+// into the pins of the net (see AntennaChecker::saveGates).
 struct GraphNode
 {
   int id;
   bool isVia;
   Polygon pol;
   std::vector<int> low_adj;
-  std::unordered_set<PinType, PinTypeHash> gates;
+  std::vector<int> gates;
   GraphNode() = default;
   GraphNode(int id_, bool isVia_, const Polygon& pol_)
   {
@@ -0,0 +1,26 @@
+source "helpers.tcl"
+# check_antennas after gates of a net change while its wire does not
+read_lef merged_spacing.lef
+read_def sw130_random.def
+
+check_antennas
+puts "violation count = [ant::antenna_violation_count]"
+
+set block [ord::get_db_block]
+set net [$block findNet "net50"]
+set gates {}
+foreach name {"_264_/B2" "output50/A"} {
+  set iterm [$block findITerm $name]
+  lappend gates $iterm
+  $iterm disconnect
+}
+
+check_antennas
+puts "violation count = [ant::antenna_violation_count]"
+
+foreach iterm $gates {
+  $iterm connect $net
+}
+
+check_antennas
+puts "violation count = [ant::antenna_violation_count]"
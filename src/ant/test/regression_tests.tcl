@@ -1,5 +1,6 @@
 record_tests {
   check_api1
+  check_cache
   check_drt1
   check_grt1
   ant_check
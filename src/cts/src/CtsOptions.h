@@ -108,6 +108,8 @@ class CtsOptions
   {
     return charWirelengthIterations_;
   }
+  void setCharCacheDir(const std::string& dir) { charCacheDir_ = dir; }
+  std::string getCharCacheDir() const { return charCacheDir_; }
   void setCapSteps(int steps) { capSteps_ = steps; }
   int getCapSteps() const { return capSteps_; }
   void setSlewSteps(int steps) { slewSteps_ = steps; }
@@ -246,6 +248,8 @@ class CtsOptions
   float getDelayBufferDerate() const { return delayBufferDerate_; }
   void enableDummyLoad(bool dummyLoad) { dummyLoad_ = dummyLoad; }
   bool dummyLoadEnabled() const { return dummyLoad_; }
+  void setNumThreads(int threads) { numThreads_ = threads; }
+  int getNumThreads() const { return numThreads_; }
 
  private:
   std::string clockNets_ = "";
@@ -273,6 +277,7 @@ class CtsOptions
   int capSteps_ = 20;
   int slewSteps_ = 7;
   unsigned charWirelengthIterations_ = 4;
+  std::string charCacheDir_ = "";
   unsigned clockTreeMaxDepth_ = 100;
   bool enableFakeLutEntries_ = true;
   bool forceBuffersOnLeafLevel_ = true;
@@ -294,6 +299,7 @@ class CtsOptions
   stt::SteinerTreeBuilder* sttBuilder_ = nullptr;
   bool obsAware_ = false;
   bool applyNDR_ = false;
+  int numThreads_ = 1;
   bool insertionDelay_ = true;
   bool bufferListInferred_ = false;
   bool sinkBufferInferred_ = false;
@@ -35,6 +35,7 @@
 
 #include "HTreeBuilder.h"
 
+#include <algorithm>
 #include <fstream>
 #include <iomanip>
 #include <iostream>
@@ -361,17 +362,65 @@ void plotBlockage(std::ofstream& file, odb::dbDatabase* db_, int scalingFactor)
   }
 }
 
+SinkDistanceSum::SinkDistanceSum(const std::vector<Point<double>>& sinks,
+                                 double delaySum)
+    : delaySum_(delaySum)
+{
+  xs_.reserve(sinks.size());
+  ys_.reserve(sinks.size());
+  for (const Point<double>& sink : sinks) {
+    xs_.push_back(sink.getX());
+    ys_.push_back(sink.getY());
+  }
+  std::sort(xs_.begin(), xs_.end());
+  std::sort(ys_.begin(), ys_.end());
+
+  prefixX_.resize(xs_.size() + 1, 0.0);
+  prefixY_.resize(ys_.size() + 1, 0.0);
+  for (size_t i = 0; i < xs_.size(); ++i) {
+    prefixX_[i + 1] = prefixX_[i] + xs_[i];
+    prefixY_[i + 1] = prefixY_[i] + ys_[i];
+  }
+}
+
+// sum of |value - coords[i]| over the sorted coords
+double SinkDistanceSum::sumAbsDiff(const std::vector<double>& coords,
+                                   const std::vector<double>& prefixSums,
+                                   double value)
+{
+  const size_t below
+      = std::lower_bound(coords.begin(), coords.end(), value) - coords.begin();
+  const size_t above = coords.size() - below;
+  const double sumBelow = prefixSums[below];
+  const double sumAbove = prefixSums[coords.size()] - sumBelow;
+  return (value * below - sumBelow) + (sumAbove - value * above);
+}
+
+double SinkDistanceSum::computeDist(const Point<double>& loc) const
+{
+  return sumAbsDiff(xs_, prefixX_, loc.getX())
+         + sumAbsDiff(ys_, prefixY_, loc.getY());
+}
+
+SinkDistanceSum HTreeBuilder::makeSinkDistanceSum(
+    const std::vector<Point<double>>& sinks)
+{
+  double delaySum = 0.0;
+  for (const Point<double>& sink : sinks) {
+    delaySum += getSinkInsertionDelay(sink);
+  }
+  return SinkDistanceSum(sinks, delaySum);
+}
+
 // distance to move sinks from old loc to new loc
 double HTreeBuilder::weightedDistance(const Point<double>& newLoc,
                                       const Point<double>& oldLoc,
-                                      const std::vector<Point<double>>& sinks)
+                                      const SinkDistanceSum& sinks)
 {
-  double dist = 0;
-  for (const Point<double>& sink : sinks) {
-    dist += computeDist(newLoc, sink);
-    dist += computeDist(newLoc, oldLoc);
-  }
-  return dist;
+  const unsigned numSinks = sinks.getNumSinks();
+  const double newLocDelay = getSinkInsertionDelay(newLoc);
+  return sinks.computeDist(newLoc) + numSinks * newLocDelay
+         + sinks.getDelaySum() + numSinks * computeDist(newLoc, oldLoc);
 }
 
 void plotSinks(std::ofstream& file, const std::vector<Point<double>>& sinks)
@@ -507,7 +556,7 @@ Point<double> HTreeBuilder::findBestLegalLocation(
     const Point<double>& branchPoint,
     const Point<double>& parentPoint,
     const std::vector<Point<double>>& legalLocations,
-    const std::vector<Point<double>>& sinks,
+    const SinkDistanceSum& sinks,
     double x1,
     double y1,
     double x2,
@@ -546,7 +595,7 @@ Point<double> HTreeBuilder::adjustBestLegalLocation(
     double targetDist,
     const Point<double>& currLoc,
     const Point<double>& parentPoint,
-    const std::vector<Point<double>>& sinks,
+    const SinkDistanceSum& sinks,
     double x1,
     double y1,
     double x2,
@@ -580,7 +629,7 @@ Point<double> HTreeBuilder::adjustBestLegalLocation(
 bool HTreeBuilder::adjustAlongBlockage(double targetDist,
                                        const Point<double>& currLoc,
                                        const Point<double>& parentPoint,
-                                       const std::vector<Point<double>>& sinks,
+                                       const SinkDistanceSum& sinks,
                                        double x1,
                                        double y1,
                                        double x2,
@@ -652,7 +701,7 @@ void HTreeBuilder::checkLegalityAndCostSpecial(
     const Point<double>& newLoc,
     const Point<double>& parentPoint,
     double targetDist,
-    const std::vector<Point<double>>& sinks,
+    const SinkDistanceSum& sinks,
     int scalingFactor,
     double x1,
     double y1,
@@ -692,7 +741,7 @@ Point<double> HTreeBuilder::adjustBeyondBlockage(
     const Point<double>& branchPoint,
     const Point<double>& parentPoint,
     double targetDist,
-    const std::vector<Point<double>>& sinks,
+    const SinkDistanceSum& sinks,
     int scalingFactor)
 {
   double px = parentPoint.getX();
@@ -918,7 +967,7 @@ void HTreeBuilder::checkLegalityAndCost(const Point<double>& oldLoc,
                                         const Point<double>& newLoc,
                                         const Point<double>& parentPoint,
                                         double targetDist,
-                                        const std::vector<Point<double>>& sinks,
+                                        const SinkDistanceSum& sinks,
                                         int scalingFactor,
                                         Point<double>& bestLoc,
                                         double& sinkDist,
@@ -992,7 +1041,7 @@ void HTreeBuilder::legalizeDummy()
                                                  branchPoint,
                                                  parentPoint,
                                                  legalLocations,
-                                                 sinks,
+                                                 makeSinkDistanceSum(sinks),
                                                  x1,
                                                  y2,
                                                  x2,
@@ -1069,7 +1118,7 @@ void HTreeBuilder::legalize()
                                                  branchPoint,
                                                  parentPoint,
                                                  legalLocations,
-                                                 sinks,
+                                                 makeSinkDistanceSum(sinks),
                                                  x1,
                                                  y1,
                                                  x2,
@@ -1094,7 +1143,7 @@ void HTreeBuilder::legalize()
         newLocation = adjustBeyondBlockage(branchPoint,
                                            parentPoint,
                                            topology.getLength(),
-                                           sinks,
+                                           makeSinkDistanceSum(sinks),
                                            scalingFactor);
         // clang-format off
 	debugPrint(logger_, CTS, "legalizer", 3,
@@ -1120,7 +1169,7 @@ void HTreeBuilder::legalize()
   }
 }
 
-void HTreeBuilder::run()
+void HTreeBuilder::prepare()
 {
   logger_->info(
       CTS, 27, "Generating H-Tree topology for net {}.", clock_.getName());
@@ -1148,16 +1197,38 @@ void HTreeBuilder::run()
 
   initSinkRegion();
 
+  // Find the level run() needs the fake LUT entries from so they can be
+  // created before any builder that uses them runs.
+  fakeLutEntriesLevel_ = 0;
+  if (options_->isFakeLutEntriesEnabled()) {
+    for (int level = 1; level <= clockTreeMaxDepth_; ++level) {
+      double regionWidth, regionHeight;
+      computeSubRegionSize(level, regionWidth, regionHeight);
+      if (isSubRegionTooSmall(regionWidth, regionHeight)) {
+        fakeLutEntriesLevel_ = level;
+        break;
+      }
+      if (isNumberOfSinksTooSmall(computeNumberOfSinksPerSubRegion(level))) {
+        break;
+      }
+    }
+  }
+}
+
+void HTreeBuilder::run()
+{
   for (int level = 1; level <= clockTreeMaxDepth_; ++level) {
     const unsigned numSinksPerSubRegion
         = computeNumberOfSinksPerSubRegion(level);
     double regionWidth, regionHeight;
     computeSubRegionSize(level, regionWidth, regionHeight);
 
+    if (fakeLutEntriesFrom_ > 0 && level >= fakeLutEntriesFrom_) {
+      useFakeLutEntries_ = true;
+    }
     if (isSubRegionTooSmall(regionWidth, regionHeight)) {
       if (options_->isFakeLutEntriesEnabled()) {
-        const unsigned minIndex = 1;
-        techChar_->createFakeEntries(minLengthSinkRegion_, minIndex);
+        // The fake entries were created by TritonCTS before the build.
         minLengthSinkRegion_ = 1;
       } else {
         logger_->info(
@@ -1431,12 +1502,26 @@ void HTreeBuilder::computeLevelTopology(const unsigned level,
   topologyForEachLevel_.push_back(topology);
 }
 
+void HTreeBuilder::forEachWireSegment(
+    const uint8_t length,
+    const uint8_t load,
+    const uint8_t outputSlew,
+    const std::function<void(unsigned, const WireSegment&)>& func) const
+{
+  techChar_->forEachWireSegment(
+      length, load, outputSlew, [&](unsigned key, const WireSegment& seg) {
+        if (useFakeLutEntries_ || !techChar_->isFakeEntry(key)) {
+          func(key, seg);
+        }
+      });
+}
+
 unsigned HTreeBuilder::computeMinDelaySegment(const unsigned length) const
 {
   unsigned minKey = std::numeric_limits<unsigned>::max();
   unsigned minDelay = std::numeric_limits<unsigned>::max();
 
-  techChar_->forEachWireSegment(
+  forEachWireSegment(
       length, 1, 1, [&](unsigned key, const WireSegment& seg) {
         if (!seg.isBuffered()) {
           return;
@@ -1465,7 +1550,7 @@ unsigned HTreeBuilder::computeMinDelaySegment(const unsigned length,
 
   for (int load = 1; load <= techChar_->getMaxCapacitance(); ++load) {
     for (int outSlew = 1; outSlew <= techChar_->getMaxSlew(); ++outSlew) {
-      techChar_->forEachWireSegment(
+      forEachWireSegment(
           length, load, outSlew, [&](unsigned key, const WireSegment& seg) {
             if (std::abs((int) seg.getInputCap() - (int) inputCap) > tolerance
                 || std::abs((int) seg.getInputSlew() - (int) inputSlew)
@@ -1546,7 +1631,7 @@ unsigned HTreeBuilder::computeMinDelaySegment(const unsigned length,
 
   for (int load = 1; load <= techChar_->getMaxCapacitance(); ++load) {
     for (int outSlew = 1; outSlew <= techChar_->getMaxSlew(); ++outSlew) {
-      techChar_->forEachWireSegment(
+      forEachWireSegment(
           length, load, outSlew, [&](unsigned key, const WireSegment& seg) {
             // Same as the other functions, however, forces a segment
             // to have a buffer in a specific location.
@@ -1708,26 +1793,28 @@ void HTreeBuilder::refineBranchingPointsWithClustering(
 
   std::vector<std::vector<unsigned>> clusters;
   clusteringEngine.getClusters(clusters);
+  // Counting the sinks closer to the other cluster needs two distance
+  // evaluations per sink, so only do it when it is reported.
+  const bool countMovedSinks = logger_->debugCheck(CTS, "clustering", 1);
   unsigned movedSinks = 0;
   const double errorFactor = 1.2;
   for (int clusterIdx = 0; clusterIdx < clusters.size(); ++clusterIdx) {
+    const unsigned branchPtIdx = clusterIdx == 0 ? branchPtIdx1 : branchPtIdx2;
     for (int elementIdx = 0; elementIdx < clusters[clusterIdx].size();
          ++elementIdx) {
       const unsigned sinkIdx = clusters[clusterIdx][elementIdx];
       const Point<double> sinkLoc(sinks[sinkIdx].first, sinks[sinkIdx].second);
-      const double dist = clusterIdx == 0 ? computeDist(branchPt1, sinkLoc)
-                                          : computeDist(branchPt2, sinkLoc);
-      const double distOther = clusterIdx == 0
-                                   ? computeDist(branchPt2, sinkLoc)
-                                   : computeDist(branchPt1, sinkLoc);
-      if (clusterIdx == 0) {
-        topology.addSinkToBranch(branchPtIdx1, sinkLoc);
-      } else {
-        topology.addSinkToBranch(branchPtIdx2, sinkLoc);
-      }
-
-      if (dist >= distOther * errorFactor) {
-        movedSinks++;
+      topology.addSinkToBranch(branchPtIdx, sinkLoc);
+
+      if (countMovedSinks) {
+        const double dist = clusterIdx == 0 ? computeDist(branchPt1, sinkLoc)
+                                            : computeDist(branchPt2, sinkLoc);
+        const double distOther = clusterIdx == 0
+                                     ? computeDist(branchPt2, sinkLoc)
+                                     : computeDist(branchPt1, sinkLoc);
+        if (dist >= distOther * errorFactor) {
+          movedSinks++;
+        }
       }
     }
   }
@@ -2031,7 +2118,8 @@ void HTreeBuilder::printHTree()
 		      " dist to parent:{:0.3f} weighted sink len:{:0.3f} "
 		      "parentPt:{}", levelIdx, idx, branchPoint, leng,
 		      computeDist(branchPoint, parentPoint),
-		      weightedDistance(branchPoint, branchPoint, sinks),
+		      weightedDistance(branchPoint, branchPoint,
+				       makeSinkDistanceSum(sinks)),
 		      parentPoint);
       // clang-format on
     }
@@ -80,6 +80,33 @@ class SegmentBuilder
   unsigned numBufferLevels_ = 0;
 };
 
+//-----------------------------------------------------------------------------
+// Sum of the Manhattan distances from a location to the sinks of a branch.
+// The sink coordinates are sorted once with prefix sums, so the many
+// candidate locations tried while legalizing a branching point are each
+// evaluated in O(log n) instead of rescanning every sink.
+class SinkDistanceSum
+{
+ public:
+  SinkDistanceSum(const std::vector<Point<double>>& sinks, double delaySum);
+
+  double computeDist(const Point<double>& loc) const;
+  unsigned getNumSinks() const { return xs_.size(); }
+  // Sum of the sink insertion delays
+  double getDelaySum() const { return delaySum_; }
+
+ private:
+  static double sumAbsDiff(const std::vector<double>& coords,
+                           const std::vector<double>& prefixSums,
+                           double value);
+
+  std::vector<double> xs_;
+  std::vector<double> ys_;
+  std::vector<double> prefixX_;
+  std::vector<double> prefixY_;
+  double delaySum_;
+};
+
 //-----------------------------------------------------------------------------
 class HTreeBuilder : public TreeBuilder
 {
@@ -179,7 +206,9 @@ class HTreeBuilder : public TreeBuilder
   {
   }
 
+  void prepare() override;
   void run() override;
+  int getFakeLutEntriesLevel() const override { return fakeLutEntriesLevel_; }
   void findLegalLocations(const Point<double>& parentPoint,
                           const Point<double>& branchPoint,
                           double x1,
@@ -212,7 +241,7 @@ class HTreeBuilder : public TreeBuilder
       const Point<double>& branchPoint,
       const Point<double>& parentPoint,
       const std::vector<Point<double>>& legalLocations,
-      const std::vector<Point<double>>& sinks,
+      const SinkDistanceSum& sinks,
       double x1,
       double y1,
       double x2,
@@ -221,7 +250,7 @@ class HTreeBuilder : public TreeBuilder
   Point<double> adjustBestLegalLocation(double targetDist,
                                         const Point<double>& currLoc,
                                         const Point<double>& parentPoint,
-                                        const std::vector<Point<double>>& sinks,
+                                        const SinkDistanceSum& sinks,
                                         double x1,
                                         double y1,
                                         double x2,
@@ -231,7 +260,7 @@ class HTreeBuilder : public TreeBuilder
                                    const Point<double>& newLoc,
                                    const Point<double>& parentPoint,
                                    double targetDist,
-                                   const std::vector<Point<double>>& sinks,
+                                   const SinkDistanceSum& sinks,
                                    int scalingFactor,
                                    double x1,
                                    double y1,
@@ -243,7 +272,7 @@ class HTreeBuilder : public TreeBuilder
   bool adjustAlongBlockage(double targetDist,
                            const Point<double>& currLoc,
                            const Point<double>& parentPoint,
-                           const std::vector<Point<double>>& sinks,
+                           const SinkDistanceSum& sinks,
                            double x1,
                            double y1,
                            double x2,
@@ -253,13 +282,13 @@ class HTreeBuilder : public TreeBuilder
   Point<double> adjustBeyondBlockage(const Point<double>& branchPoint,
                                      const Point<double>& parentPoint,
                                      double targetDist,
-                                     const std::vector<Point<double>>& sinks,
+                                     const SinkDistanceSum& sinks,
                                      int scalingFactor);
   void checkLegalityAndCost(const Point<double>& oldLoc,
                             const Point<double>& newLoc,
                             const Point<double>& parentPoint,
                             double targetDist,
-                            const std::vector<Point<double>>& sinks,
+                            const SinkDistanceSum& sinks,
                             int scalingFactor,
                             Point<double>& bestLoc,
                             double& sinkDist,
@@ -302,6 +331,13 @@ class HTreeBuilder : public TreeBuilder
   void computeSubRegionSize(unsigned level,
                             double& width,
                             double& height) const;
+  // The LUT segments for length, load and outputSlew, without the fake
+  // entries unless this builder has reached the level it uses them from.
+  void forEachWireSegment(
+      uint8_t length,
+      uint8_t load,
+      uint8_t outputSlew,
+      const std::function<void(unsigned, const WireSegment&)>& func) const;
   unsigned computeMinDelaySegment(unsigned length) const;
   unsigned computeMinDelaySegment(unsigned length,
                                   unsigned inputSlew,
@@ -374,9 +410,10 @@ class HTreeBuilder : public TreeBuilder
     return numSinksPerSubRegion < numMaxLeafSinks_;
   }
 
+  SinkDistanceSum makeSinkDistanceSum(const std::vector<Point<double>>& sinks);
   double weightedDistance(const Point<double>& newLoc,
                           const Point<double>& oldLoc,
-                          const std::vector<Point<double>>& sinks);
+                          const SinkDistanceSum& sinks);
   void scalePosition(Point<double>& loc,
                      const Point<double>& parLoc,
                      double leng,
@@ -398,6 +435,8 @@ class HTreeBuilder : public TreeBuilder
   unsigned numMaxLeafSinks_ = 0;
   unsigned minLengthSinkRegion_ = 0;
   unsigned clockTreeMaxDepth_ = 0;
+  int fakeLutEntriesLevel_ = 0;
+  bool useFakeLutEntries_ = false;
   static constexpr int min_clustering_sinks_ = 200;
   std::vector<unsigned> clusterDiameters_ = {50, 100, 200};
   std::vector<unsigned> clusterSizes_ = {10, 20, 30};
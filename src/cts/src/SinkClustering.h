@@ -98,6 +98,10 @@ class SinkClustering
   void sortPoints();
   void writePlotFile();
   bool findBestMatching(unsigned groupSize);
+  double clusterFromOffset(unsigned offset,
+                           unsigned groupSize,
+                           const std::vector<double>& insertionDelays,
+                           std::vector<std::vector<unsigned>>& solution);
   void writePlotFile(unsigned groupSize);
 
   double computeTheta(double x, double y) const;
@@ -35,9 +35,13 @@
 
 #include "TechChar.h"
 
+#include <unistd.h>
+
 #include <algorithm>
+#include <filesystem>
 #include <fstream>
 #include <iomanip>
+#include <limits>
 #include <ostream>
 #include <sstream>
 
@@ -382,10 +386,16 @@ void TechChar::createFakeEntries(unsigned length, unsigned fakeLength)
   if (length == fakeLength) {
     return;
   }
+  // The entries only depend on the lengths, so create them once
+  if (!fakeEntries_.insert({length, fakeLength}).second) {
+    return;
+  }
 
   if (logger_->debugCheck(utl::CTS, "tech char", 1)) {
     logger_->warn(CTS, 45, "Creating fake entries in the LUT.");
   }
+  fakeSegmentsBegin_
+      = std::min<unsigned>(fakeSegmentsBegin_, wireSegments_.size());
   for (unsigned load = 1; load <= getMaxCapacitance(); ++load) {
     for (unsigned outSlew = 1; outSlew <= getMaxSlew(); ++outSlew) {
       forEachWireSegment(
@@ -559,7 +569,7 @@ void TechChar::initCharacterization()
   }
 
   // Required to make sure that the fake entry for minLengthSinkRegion
-  // exists (see HTreeBuilder::run())
+  // exists (see TritonCTS::buildClockTrees())
   if (options_->isFakeLutEntriesEnabled()) {
     maxWirelength = std::max(maxWirelength, 2 * options_->getWireSegmentUnit());
   }
@@ -1541,10 +1551,190 @@ unsigned TechChar::normalizeCharResults(float value,
   return normVal;
 }
 
+// Everything the LUT depends on.  Liberty files are identified by name and
+// modification time rather than by content.
+std::string TechChar::characterizationKey() const
+{
+  std::ostringstream key;
+  key << std::hexfloat;
+  key << "dbu " << db_->getChip()->getBlock()->getDbUnitsPerMicron();
+  key << " corner " << openSta_->cmdCorner()->name();
+  key << " rc " << resPerDBU_ << " " << capPerDBU_;
+  key << " buffers";
+  for (const std::string& name : masterNames_) {
+    key << " " << name;
+    odb::dbMaster* master = db_->findMaster(name.c_str());
+    sta::LibertyCell* cell
+        = master ? db_network_->libertyCell(db_network_->dbToSta(master))
+                 : nullptr;
+    if (cell) {
+      const char* libFile = cell->libertyLibrary()->filename();
+      key << " " << libFile;
+      std::error_code error;
+      const auto time = std::filesystem::last_write_time(libFile, error);
+      if (!error) {
+        key << " " << time.time_since_epoch().count();
+      }
+    }
+  }
+  key << " char_buf " << charBuf_->getName();
+  key << " units " << options_->getWireSegmentUnit() << " " << lengthUnit_;
+  key << " max_slew " << options_->getMaxCharSlew();
+  key << " steps " << charSlewStepSize_ << " " << charCapStepSize_;
+  key << " lengths";
+  for (float length : wirelengthsToTest_) {
+    key << " " << length;
+  }
+  key << " loads";
+  for (float load : loadsToTest_) {
+    key << " " << load;
+  }
+  key << " slews";
+  for (float slew : slewsToTest_) {
+    key << " " << slew;
+  }
+  return key.str();
+}
+
+// Reads the post processed results saved by writeCharacterization.  Returns
+// false if the file is missing, was made for another key or is truncated.
+bool TechChar::readCharacterization(const std::string& file,
+                                    const std::string& key,
+                                    std::vector<ResultData>& solutions)
+{
+  std::ifstream in(file);
+  std::string line;
+  if (!in || !std::getline(in, line) || line != "key " + key) {
+    return false;
+  }
+
+  std::string token;
+  unsigned bounds[6];
+  in >> token;
+  if (token != "bounds") {
+    return false;
+  }
+  for (unsigned& bound : bounds) {
+    in >> bound;
+  }
+  size_t count = 0;
+  in >> token >> count;
+  if (!in || token != "solutions") {
+    return false;
+  }
+
+  solutions.clear();
+  solutions.reserve(count);
+  for (size_t i = 0; i < count; ++i) {
+    ResultData result;
+    size_t topologySize = 0;
+    in >> result.load >> result.inSlew >> result.wirelength >> result.pinSlew
+        >> result.pinArrival >> result.totalcap >> result.totalPower
+        >> result.isPureWire >> topologySize;
+    result.topology.resize(topologySize);
+    for (std::string& node : result.topology) {
+      in >> node;
+    }
+    if (!in) {
+      return false;
+    }
+    solutions.push_back(std::move(result));
+  }
+
+  minSlew_ = bounds[0];
+  maxSlew_ = bounds[1];
+  minCapacitance_ = bounds[2];
+  maxCapacitance_ = bounds[3];
+  minSegmentLength_ = bounds[4];
+  maxSegmentLength_ = bounds[5];
+  return true;
+}
+
+// The file is written under a temporary name and renamed, so concurrent
+// runs sharing the cache directory never read a partial file.
+void TechChar::writeCharacterization(
+    const std::string& file,
+    const std::string& key,
+    const std::vector<ResultData>& solutions) const
+{
+  std::error_code error;
+  std::filesystem::create_directories(
+      std::filesystem::path(file).parent_path(), error);
+
+  const std::string tmpFile = fmt::format("{}.{}.tmp", file, getpid());
+  {
+    std::ofstream out(tmpFile);
+    if (!out) {
+      logger_->warn(
+          CTS, 126, "Unable to write characterization cache {}.", file);
+      return;
+    }
+    out << std::setprecision(std::numeric_limits<float>::max_digits10);
+    out << "key " << key << "\n";
+    out << "bounds " << minSlew_ << " " << maxSlew_ << " " << minCapacitance_
+        << " " << maxCapacitance_ << " " << minSegmentLength_ << " "
+        << maxSegmentLength_ << "\n";
+    out << "solutions " << solutions.size() << "\n";
+    for (const ResultData& result : solutions) {
+      out << result.load << " " << result.inSlew << " " << result.wirelength
+          << " " << result.pinSlew << " " << result.pinArrival << " "
+          << result.totalcap << " " << result.totalPower << " "
+          << result.isPureWire << " " << result.topology.size();
+      for (const std::string& node : result.topology) {
+        out << " " << node;
+      }
+      out << "\n";
+    }
+  }
+  std::filesystem::rename(tmpFile, file, error);
+  if (error) {
+    std::filesystem::remove(tmpFile, error);
+    logger_->warn(CTS,
+                  128,
+                  "Unable to rename characterization cache {} to {}.",
+                  tmpFile,
+                  file);
+  }
+}
+
+// 64-bit FNV-1a of the key.  Unlike std::hash it is the same for every
+// build, so runs of different binaries share the cache files.
+uint64_t TechChar::characterizationKeyHash(const std::string& key)
+{
+  uint64_t hash = 0xcbf29ce484222325;
+  for (const char c : key) {
+    hash ^= static_cast<unsigned char>(c);
+    hash *= 0x100000001b3;
+  }
+  return hash;
+}
+
 void TechChar::create()
 {
   // Setup of the attributes required to run the characterization.
   initCharacterization();
+
+  // Reuse the results of an identical characterization if there is one.
+  std::string cacheFile;
+  std::string cacheKey;
+  if (!options_->getCharCacheDir().empty()) {
+    cacheKey = characterizationKey();
+    const std::string name = fmt::format(
+        "cts_char_{:016x}.txt", characterizationKeyHash(cacheKey));
+    cacheFile = (std::filesystem::path(options_->getCharCacheDir()) / name)
+                    .string();
+    std::vector<ResultData> cachedSolutions;
+    if (readCharacterization(cacheFile, cacheKey, cachedSolutions)) {
+      logger_->info(CTS,
+                    127,
+                    "Loaded characterization from cache directory {}.",
+                    options_->getCharCacheDir());
+      compileLut(cachedSolutions);
+      odb::dbBlock::destroy(charBlock_);
+      return;
+    }
+  }
+
   long unsigned int topologiesCreated = 0;
   for (unsigned setupWirelength : wirelengthsToTest_) {
     // Creates the topologies for the current wirelength.
@@ -1681,6 +1871,9 @@ void TechChar::create()
   // Post-processing of the results.
   const std::vector<ResultData> convertedSolutions
       = characterizationPostProcess();
+  if (!cacheFile.empty()) {
+    writeCharacterization(cacheFile, cacheKey, convertedSolutions);
+  }
   compileLut(convertedSolutions);
   if (logger_->debugCheck(CTS, "characterization", 3)) {
     printCharacterization();
@@ -45,6 +45,7 @@
 #include <deque>
 #include <functional>
 #include <iostream>
+#include <limits>
 #include <set>
 #include <string>
 #include <unordered_map>
@@ -188,6 +189,7 @@ class TechChar
   unsigned getLengthUnit() const { return lengthUnit_; }
 
   void createFakeEntries(unsigned length, unsigned fakeLength);
+  bool isFakeEntry(unsigned idx) const { return idx >= fakeSegmentsBegin_; }
 
   double getCapPerDBU() const { return capPerDBU_; }
   utl::Logger* getLogger() { return options_->getLogger(); }
@@ -302,6 +304,14 @@ class TechChar
                           unsigned nodeIndex,
                           const std::string& newMasterName);
   std::vector<ResultData> characterizationPostProcess();
+  std::string characterizationKey() const;
+  static uint64_t characterizationKeyHash(const std::string& key);
+  bool readCharacterization(const std::string& file,
+                            const std::string& key,
+                            std::vector<ResultData>& solutions);
+  void writeCharacterization(const std::string& file,
+                             const std::string& key,
+                             const std::vector<ResultData>& solutions) const;
   unsigned normalizeCharResults(float value,
                                 float iter,
                                 unsigned* min,
@@ -351,6 +361,10 @@ class TechChar
   std::vector<float> slewsToTest_;
 
   std::map<CharKey, std::vector<ResultData>> solutionMap_;
+  // (length, fakeLength) pairs already passed to createFakeEntries
+  std::set<std::pair<unsigned, unsigned>> fakeEntries_;
+  // Fake entries are created after all real ones, from this index on.
+  unsigned fakeSegmentsBegin_ = std::numeric_limits<unsigned>::max();
   // keep track of acceptable buffering combinations in topology
   boost::unordered_map<std::pair<size_t, size_t>, unsigned, PairHash, PairEqual>
       bufferingComboTable_;
@@ -99,7 +99,15 @@ class TreeBuilder
     }
   }
 
+  // Work done before the fake LUT entries are settled, such as sink
+  // clustering. Called for a builder before its run.
+  virtual void prepare() {}
   virtual void run() = 0;
+  // The first level whose sink region is too small for the LUT without its
+  // fake entries, or 0. Valid after prepare.
+  virtual int getFakeLutEntriesLevel() const { return 0; }
+  // Use the fake LUT entries from level on, or not at all for 0.
+  void useFakeLutEntriesFrom(int level) { fakeLutEntriesFrom_ = level; }
   void initBlockages();
   void setTechChar(TechChar& techChar) { techChar_ = &techChar; }
   const Clock& getClock() const { return clock_; }
@@ -258,6 +266,7 @@ class TreeBuilder
   // is buffer levels (depth) of tree in all legs.
   // This becomes buffer level for whole tree thus
   unsigned treeBufLevels_ = 0;
+  int fakeLutEntriesFrom_ = 0;
   std::set<ClockInst*> first_level_sink_drivers_;
   std::set<ClockInst*> second_level_sink_drivers_;
   std::set<ClockInst*> tree_level_buffers_;
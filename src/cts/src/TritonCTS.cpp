@@ -35,6 +35,7 @@
 
 #include "cts/TritonCTS.h"
 
+#include <algorithm>
 #include <cctype>
 #include <chrono>
 #include <ctime>
@@ -58,7 +59,9 @@
 #include "sta/Liberty.hh"
 #include "sta/PatternMatch.hh"
 #include "sta/Sdc.hh"
+#include "stt/flute.h"
 #include "utl/Logger.h"
+#include "utl/exception.h"
 
 namespace cts {
 
@@ -166,7 +169,69 @@ void TritonCTS::buildClockTrees()
     builder->setDb(db_);
     builder->setLogger(logger_);
     builder->initBlockages();
-    builder->run();
+  }
+
+  // The trees of different clocks (and the macro/register trees of one
+  // clock) are independent until writeDataToDb commits them in builder
+  // order, so they can be built concurrently.  Plotting and the gui
+  // observer keep the build serial.
+  int threads = options_->getNumThreads();
+  if (options_->getPlotSolution() || options_->getObserver()
+      || logger_->debugCheck(CTS, "HTree", 2)) {
+    threads = 1;
+  }
+  const int builder_count = builders_->size();
+  threads = std::max(1, std::min(threads, builder_count));
+
+  // A builder whose sink region gets too small needs the fake LUT entries
+  // from that level on, and every builder after it sees them too.  Settle
+  // this in builder order so the trees do not depend on the thread count.
+  bool fake_entries = false;
+  auto assignFakeLutEntries = [&](TreeBuilder* builder) {
+    const int level = builder->getFakeLutEntriesLevel();
+    if (fake_entries) {
+      builder->useFakeLutEntriesFrom(1);
+    } else if (level > 0) {
+      techChar_->createFakeEntries(techChar_->getMinSegmentLength() * 2, 1);
+      builder->useFakeLutEntriesFrom(level);
+      fake_entries = true;
+    }
+  };
+
+  if (threads == 1) {
+    for (TreeBuilder* builder : *builders_) {
+      builder->prepare();
+      assignFakeLutEntries(builder);
+      builder->run();
+    }
+  } else {
+    // sink clustering builds steiner trees; load the flute tables up front
+    stt::flt::initAllLUT();
+
+    utl::ThreadException exception;
+#pragma omp parallel for num_threads(threads) schedule(dynamic)
+    for (int i = 0; i < builder_count; ++i) {
+      try {
+        (*builders_)[i]->prepare();
+      } catch (...) {
+        exception.capture();
+      }
+    }
+    exception.rethrow();
+
+    for (TreeBuilder* builder : *builders_) {
+      assignFakeLutEntries(builder);
+    }
+
+#pragma omp parallel for num_threads(threads) schedule(dynamic)
+    for (int i = 0; i < builder_count; ++i) {
+      try {
+        (*builders_)[i]->run();
+      } catch (...) {
+        exception.capture();
+      }
+    }
+    exception.rethrow();
   }
 
   if (options_->getBalanceLevels()) {
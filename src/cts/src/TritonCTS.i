@@ -90,6 +90,12 @@ set_max_char_slew(double slew)
   getTritonCts()->getParms()->setMaxCharSlew(slew);
 }
 
+void
+set_char_cache_dir(const char* dir)
+{
+  getTritonCts()->getParms()->setCharCacheDir(dir);
+}
+
 void
 set_wire_segment_distance_unit(unsigned unit)
 {
@@ -257,6 +263,8 @@ set_delay_buffer_derate(float derate)
 void
 run_triton_cts()
 {
+  getTritonCts()->getParms()->setNumThreads(
+      ord::OpenRoad::openRoad()->getThreadCount());
   getTritonCts()->runTritonCts();
 }
 
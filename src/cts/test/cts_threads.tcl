@@ -0,0 +1,61 @@
+# clock_tree_synthesis builds the same trees with 1 and with 4 threads
+source "helpers.tcl"
+
+proc build_clock_trees { threads def_file } {
+  source Nangate45/Nangate45.vars
+  read_liberty Nangate45/Nangate45_typ.lib
+  read_liberty array_tile_ins_delay.lib
+  read_lef Nangate45/Nangate45.lef
+  read_lef array_tile_ins_delay.lef
+  read_def insertion_delay.def
+
+  source Nangate45/Nangate45.rc
+  source $layer_rc_file
+  set_wire_rc -signal -layer $wire_rc_layer
+  set_wire_rc -clock  -layer $wire_rc_layer_clk
+
+  create_clock -name core -period 5 clk
+
+  # The macro and register trees are built concurrently with more than one
+  # thread.  The macro tree's sink region is too small for the LUT, so it
+  # adds the fake LUT entries the register tree must see in both cases.
+  set_thread_count $threads
+  clock_tree_synthesis -root_buf CLKBUF_X3 \
+                       -buf_list CLKBUF_X3 \
+                       -wire_unit 20 \
+                       -sink_clustering_enable \
+                       -distance_between_buffers 100 \
+                       -sink_clustering_size 10 \
+                       -sink_clustering_max_diameter 60 \
+                       -num_static_layers 1 \
+                       -obstruction_aware
+  write_def $def_file
+}
+
+# Each build runs in its own openroad process to start from a fresh db.
+if { [info exists ::env(CTS_THREADS)] } {
+  build_clock_trees $::env(CTS_THREADS) $::env(CTS_THREADS_DEF)
+  exit
+}
+
+set def_files {}
+foreach threads {1 4} {
+  set def_file [make_result_file "cts_threads_$threads.def"]
+  set ::env(CTS_THREADS) $threads
+  set ::env(CTS_THREADS_DEF) $def_file
+  set openroad [info nameofexecutable]
+  if { [catch { exec $openroad -no_init -exit [info script] 2>@1 } output] } {
+    puts $output
+    puts "fail - build with $threads threads failed"
+    exit 1
+  }
+  lappend def_files $def_file
+}
+
+if { [diff_files {*}$def_files] } {
+  puts "fail - the trees built with 1 and 4 threads differ"
+  exit 1
+}
+
+puts "pass"
+exit
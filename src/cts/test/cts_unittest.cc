@@ -4,9 +4,20 @@
 // license that can be found in the LICENSE file or at
 // https://developers.google.com/open-source/licenses/bsd
 
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <random>
+#include <utility>
+#include <vector>
+
 #include "gtest/gtest.h"
 #include "src/cts/src/Clock.h"
+#include "src/cts/src/Clustering.h"
+#include "src/cts/src/CtsOptions.h"
 #include "src/cts/src/HTreeBuilder.h"
+#include "src/cts/src/SinkClustering.h"
+#include "src/cts/src/TechChar.h"
 #include "utl/Logger.h"
 
 namespace cts {
@@ -24,4 +35,211 @@ TEST(HTreeBuilderTest, Instantiates)
       /*options=*/nullptr, clock, /*parent=*/nullptr, &logger, nullptr);
 }
 
+std::vector<std::vector<unsigned>> clusterGrid(int threads)
+{
+  Clock clock(/*netName=*/"clk",
+              /*clockPin=*/"p0",
+              /*sdcClockName=*/"clk",
+              /*clockPinX=*/0,
+              /*clockPinY=*/0);
+  utl::Logger logger;
+  CtsOptions options(&logger, /*sttBuildder=*/nullptr);
+  options.setSinkClusteringSize(10);
+  options.setNumThreads(threads);
+  TechChar techChar(&options, nullptr, nullptr, nullptr, nullptr, &logger);
+  HTreeBuilder htree(&options, clock, /*parent=*/nullptr, &logger, nullptr);
+
+  SinkClustering matching(&options, &techChar, &htree);
+  for (int x = 0; x < 100; ++x) {
+    for (int y = 0; y < 100; ++y) {
+      matching.addPoint(x, y);
+      matching.addCap(1.0);
+    }
+  }
+  unsigned bestSize = 0;
+  float bestDiameter = 0.0;
+  matching.run(/*groupSize=*/10,
+               /*maxDiameter=*/10,
+               /*scaleFactor=*/1,
+               bestSize,
+               bestDiameter);
+  EXPECT_EQ(bestSize, 10);
+  return matching.sinkClusteringSolution();
+}
+
+TEST(SinkClusteringTest, ClustersEachSinkOnce)
+{
+  const std::vector<std::vector<unsigned>> clusters = clusterGrid(1);
+  std::vector<int> count(100 * 100, 0);
+  for (const std::vector<unsigned>& cluster : clusters) {
+    EXPECT_FALSE(cluster.empty());
+    EXPECT_LE(cluster.size(), 10);
+    for (unsigned idx : cluster) {
+      count[idx]++;
+    }
+  }
+  for (int sinkCount : count) {
+    EXPECT_EQ(sinkCount, 1);
+  }
+
+  EXPECT_EQ(clusterGrid(4), clusters);
+}
+
+// Synthetic sink distributions for the clustering benchmarks.
+enum class SinkDistribution
+{
+  Uniform,
+  Hotspots,
+  Grid
+};
+
+std::vector<std::pair<float, float>> makeSinks(SinkDistribution distribution,
+                                               int numSinks,
+                                               float dieSize)
+{
+  std::mt19937 rng(42);
+  std::vector<std::pair<float, float>> sinks;
+  sinks.reserve(numSinks);
+  switch (distribution) {
+    case SinkDistribution::Uniform: {
+      std::uniform_real_distribution<float> coord(0, dieSize);
+      for (int i = 0; i < numSinks; ++i) {
+        sinks.emplace_back(coord(rng), coord(rng));
+      }
+      break;
+    }
+    case SinkDistribution::Hotspots: {
+      // Most sinks packed around a few register banks.
+      std::uniform_real_distribution<float> coord(0, dieSize);
+      std::vector<std::pair<float, float>> centers;
+      for (int i = 0; i < 16; ++i) {
+        centers.emplace_back(coord(rng), coord(rng));
+      }
+      std::normal_distribution<float> offset(0, dieSize / 64);
+      for (int i = 0; i < numSinks; ++i) {
+        const std::pair<float, float>& center = centers[i % centers.size()];
+        sinks.emplace_back(center.first + offset(rng),
+                           center.second + offset(rng));
+      }
+      break;
+    }
+    case SinkDistribution::Grid: {
+      const int side = std::ceil(std::sqrt(numSinks));
+      const float pitch = dieSize / side;
+      for (int i = 0; i < numSinks; ++i) {
+        sinks.emplace_back((i % side) * pitch, (i / side) * pitch);
+      }
+      break;
+    }
+  }
+  return sinks;
+}
+
+const char* distributionName(SinkDistribution distribution)
+{
+  switch (distribution) {
+    case SinkDistribution::Uniform:
+      return "uniform";
+    case SinkDistribution::Hotspots:
+      return "hotspots";
+    case SinkDistribution::Grid:
+      return "grid";
+  }
+  return "";
+}
+
+constexpr SinkDistribution sinkDistributions[]
+    = {SinkDistribution::Uniform,
+       SinkDistribution::Hotspots,
+       SinkDistribution::Grid};
+
+// Timings for growing sink counts, to see how clustering scales.  Run with
+//   cts_unittest --gtest_also_run_disabled_tests
+//                --gtest_filter='*Benchmark*'
+TEST(SinkClusteringTest, DISABLED_Benchmark)
+{
+  Clock clock(/*netName=*/"clk",
+              /*clockPin=*/"p0",
+              /*sdcClockName=*/"clk",
+              /*clockPinX=*/0,
+              /*clockPinY=*/0);
+  utl::Logger logger;
+  CtsOptions options(&logger, /*sttBuildder=*/nullptr);
+  options.setSinkClusteringSize(20);
+  TechChar techChar(&options, nullptr, nullptr, nullptr, nullptr, &logger);
+  HTreeBuilder htree(&options, clock, /*parent=*/nullptr, &logger, nullptr);
+
+  for (const SinkDistribution distribution : sinkDistributions) {
+    for (const int numSinks : {10000, 100000, 1000000}) {
+      SinkClustering matching(&options, &techChar, &htree);
+      for (const auto& [x, y] :
+           makeSinks(distribution, numSinks, /*dieSize=*/10000)) {
+        matching.addPoint(x, y);
+        matching.addCap(1.0);
+      }
+      unsigned bestSize = 0;
+      float bestDiameter = 0.0;
+      const auto start = std::chrono::steady_clock::now();
+      matching.run(/*groupSize=*/20,
+                   /*maxDiameter=*/50,
+                   /*scaleFactor=*/1,
+                   bestSize,
+                   bestDiameter);
+      const std::chrono::duration<double> elapsed
+          = std::chrono::steady_clock::now() - start;
+      std::cout << "SinkClustering " << distributionName(distribution) << " "
+                << numSinks << " sinks: " << elapsed.count() << " s, "
+                << matching.sinkClusteringSolution().size() << " clusters\n";
+    }
+  }
+}
+
+TEST(ClusteringTest, DISABLED_Benchmark)
+{
+  utl::Logger logger;
+  for (const SinkDistribution distribution : sinkDistributions) {
+    for (const int numSinks : {1000, 10000, 100000}) {
+      const std::vector<std::pair<float, float>> sinks
+          = makeSinks(distribution, numSinks, /*dieSize=*/10000);
+      // The two branching points refineBranchingPointsWithClustering
+      // starts from for a horizontal branch across the die.
+      std::vector<std::pair<float, float>> means = {{2500, 5000}, {7500, 5000}};
+      CKMeans::Clustering clustering(sinks, 5000, 5000, &logger);
+      const auto start = std::chrono::steady_clock::now();
+      clustering.iterKmeans(/*iter=*/1,
+                            means.size(),
+                            /*cap=*/numSinks * 0.6,
+                            /*max=*/5,
+                            /*power=*/4,
+                            means);
+      const std::chrono::duration<double> elapsed
+          = std::chrono::steady_clock::now() - start;
+      std::cout << "Clustering " << distributionName(distribution) << " "
+                << numSinks << " sinks: " << elapsed.count() << " s\n";
+    }
+  }
+}
+
+TEST(HTreeBuilderTest, SinkDistanceSumMatchesSum)
+{
+  std::vector<Point<double>> sinks;
+  for (int i = 0; i < 50; ++i) {
+    sinks.emplace_back((i * 37) % 101, (i * 53) % 89 + 0.5);
+  }
+  const SinkDistanceSum sinkDists(sinks, /*delaySum=*/2.0);
+  EXPECT_EQ(sinkDists.getNumSinks(), sinks.size());
+  EXPECT_DOUBLE_EQ(sinkDists.getDelaySum(), 2.0);
+
+  for (const Point<double> loc : {Point<double>(-10, -10),
+                                  Point<double>(37, 53.5),
+                                  Point<double>(50.25, 44),
+                                  Point<double>(200, 150)}) {
+    double dist = 0.0;
+    for (const Point<double>& sink : sinks) {
+      dist += loc.computeDist(sink);
+    }
+    EXPECT_NEAR(sinkDists.computeDist(loc), dist, 1e-9);
+  }
+}
+
 }  // namespace cts
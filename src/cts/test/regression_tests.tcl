@@ -5,6 +5,7 @@ record_tests {
   find_clock
   find_clock_pad
   no_clocks
+  char_cache
   no_sinks
   simple_test
   simple_test_clustered
@@ -21,3 +22,7 @@ record_tests {
   #cts_readme_msgs_check
   #cts_man_tcl_check
 }
+
+record_pass_fail_tests {
+  cts_threads
+}
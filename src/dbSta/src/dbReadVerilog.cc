@@ -257,6 +257,9 @@ void Verilog2db::makeDbNetlist()
   std::vector<std::pair<const Instance*, dbModule*>> inst_module_vec;
   recordBusPortsOrder();
   makeDbModule(network_->topInstance(), /* parent */ nullptr, inst_module_vec);
+  // Net count roughly tracks the instance count; pre-size the net name
+  // table so it is not repeatedly resized while the nets are created.
+  block_->reserveNameTables(0, block_->getInsts().size());
   makeDbNets(network_->topInstance());
   if (hierarchy_) {
     makeVModNets(inst_module_vec);
@@ -891,6 +891,29 @@ class dbBlock : public dbObject
   ///
   dbBox* getBBox();
 
+  ///
+  /// Freeze the block into a read-only snapshot.
+  ///
+  /// While frozen, iterating over the block's objects, name lookups
+  /// (findNet, findInst, findITerm, ...), property lookups and decoding
+  /// wires with a per-thread dbWireDecoder may be done concurrently from
+  /// multiple threads. Lazily computed data is computed by freeze() so
+  /// readers never write to the block. Netlist, placement and wire edits,
+  /// including renames and master swaps, are rejected with an error until
+  /// unfreeze() is called.
+  ///
+  void freeze();
+
+  ///
+  /// Allow edits to the block again after freeze().
+  ///
+  void unfreeze();
+
+  ///
+  /// Returns true if the block is frozen.
+  ///
+  bool isFrozen();
+
   ///
   /// Get the chip this block belongs too.
   ///
@@ -1139,6 +1162,13 @@ class dbBlock : public dbObject
   ///
   dbNet* findNet(const char* name);
 
+  ///
+  /// Size the instance and net name tables for num_insts more instances
+  /// and num_nets more nets, so a bulk load (e.g. a DEF or Verilog reader)
+  /// does not resize them while the objects are created.
+  ///
+  void reserveNameTables(uint num_insts, uint num_nets);
+
   ///
   /// Find a set of nets. Each name can be real name, or Nxxx, or xxx,
   /// where xxx is the net oid.
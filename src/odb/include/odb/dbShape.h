@@ -32,6 +32,9 @@
 
 #pragma once
 
+#include <map>
+#include <vector>
+
 #include "ZException.h"
 #include "dbObject.h"
 #include "dbSet.h"
@@ -358,6 +361,68 @@ class dbWirePathItr
   bool getNextShape(dbWirePathShape& shape);
 };
 
+///////////////////////////////////////////////////////////////////////////////
+///
+/// dbWireShapeIndex - Random access to the shapes of a dbWire.
+///
+/// The wire is decoded once into flat arrays of shapes and junction points,
+/// so repeated queries by shape-id, junction-id or layer do not re-decode
+/// the wire. The index is not updated when the wire is modified, it must be
+/// rebuilt.
+///
+///////////////////////////////////////////////////////////////////////////////
+class dbWireShapeIndex
+{
+  std::vector<dbShape> _shapes;
+  std::vector<int> _shape_ids;
+  std::vector<int> _shape_idx;     // shape-id -> index in _shapes, or -1
+  std::vector<Point> _points;      // junction-id -> point
+  std::vector<bool> _has_point;    // junction-id -> true if a point
+  std::map<dbTechLayer*, std::vector<int>> _layer_shapes;
+  std::vector<int> _no_shapes;
+
+  void addLayerShape(dbTechLayer* layer, int idx);
+
+ public:
+  ///
+  /// Decode the wire, discarding any previous contents.
+  ///
+  void build(dbWire* wire);
+
+  ///
+  /// Discard the decoded shapes.
+  ///
+  void clear();
+
+  ///
+  /// All the shapes of the wire in the order of dbWireShapeItr.
+  ///
+  const std::vector<dbShape>& getShapes() const { return _shapes; }
+
+  ///
+  /// The shape-id of each shape returned by getShapes().
+  ///
+  const std::vector<int>& getShapeIds() const { return _shape_ids; }
+
+  ///
+  /// Get the shape of this shape-id. Returns false if the shape-id is not
+  /// the id of a wire segment or via.
+  ///
+  bool getShape(int shape_id, dbShape& shape) const;
+
+  ///
+  /// Get the point of this junction-id. Returns false if the junction-id is
+  /// not the id of a point or via.
+  ///
+  bool getCoord(int jid, Point& point) const;
+
+  ///
+  /// The indices into getShapes() of the shapes on this layer. Vias are
+  /// listed on both their bottom and top layers.
+  ///
+  const std::vector<int>& getLayerShapes(dbTechLayer* layer) const;
+};
+
 ///////////////////////////////////////////////////////////////////////////////
 ///
 /// dbInstShapeItr
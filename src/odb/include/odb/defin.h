@@ -70,6 +70,8 @@ class defin
   void skipBlockWires();
   void skipFillWires();
   void continueOnErrors();
+  /// Tokenize large sections (COMPONENTS) with this many threads.
+  void setThreadCount(int threads);
   void namesAreDBIDs();
   void setAssemblyMode();
   void useBlockName(const char* name);
@@ -65,6 +65,8 @@ class defout
   void setUseMasterIds(bool value);
   void selectNet(dbNet* net);
   void setVersion(Version v);  // default is 5.8
+  // Format the COMPONENTS and NETS sections with this many threads.
+  void setThreadCount(int threads);
 
   bool writeBlock(dbBlock* block, const char* def_file);
 };
@@ -78,6 +78,10 @@ class Ath__parser
   void reportProgress();
   int mkWords(int jj);
   bool isSeparator(char a);
+  void updateSeparators();
+  bool mapFile(const char* name);
+  void unmapFile();
+  bool readMappedLine();
 
   char* _line;
   char* _tmpLine;
@@ -92,6 +96,14 @@ class Ath__parser
   FILE* _inFP;
   char* _inputFile;
 
+  // Plain input files are memory mapped and read from _mapData instead
+  // of _inFP.
+  const char* _mapData = nullptr;
+  size_t _mapSize = 0;
+  size_t _mapPos = 0;
+
+  bool _isSeparator[256];
+
   int _progressLineChunk;
   utl::Logger* _logger;
 };
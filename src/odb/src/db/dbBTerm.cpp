@@ -325,6 +325,7 @@ bool dbBTerm::rename(const char* name)
 {
   _dbBTerm* bterm = (_dbBTerm*) this;
   _dbBlock* block = (_dbBlock*) getBlock();
+  block->checkNotFrozen("rename bterm");
 
   if (block->_bterm_hash.hasMember(name)) {
     return false;
@@ -692,6 +693,7 @@ dbBTerm* dbBTerm::create(dbNet* net_, const char* name)
 {
   _dbNet* net = (_dbNet*) net_;
   _dbBlock* block = (_dbBlock*) net->getOwner();
+  block->checkNotFrozen("create bterm");
 
   if (block->_bterm_hash.hasMember(name)) {
     return nullptr;
@@ -797,6 +799,7 @@ void dbBTerm::destroy(dbBTerm* bterm_)
 {
   _dbBTerm* bterm = (_dbBTerm*) bterm_;
   _dbBlock* block = (_dbBlock*) bterm->getOwner();
+  block->checkNotFrozen("destroy bterm");
 
   if (bterm->_net) {
     _dbNet* net = block->_net_tbl->getPtr(bterm->_net);
@@ -417,6 +417,7 @@ _dbBlock::_dbBlock(_dbDatabase* db)
   _extmi = nullptr;
   _journal = nullptr;
   _journal_pending = nullptr;
+  _frozen = false;
 }
 
 _dbBlock::_dbBlock(_dbDatabase* db, const _dbBlock& block)
@@ -627,6 +628,7 @@ _dbBlock::_dbBlock(_dbDatabase* db, const _dbBlock& block)
   _extmi = block._extmi;
   _journal = nullptr;
   _journal_pending = nullptr;
+  _frozen = false;
 }
 
 _dbBlock::~_dbBlock()
@@ -1213,6 +1215,14 @@ void _dbBlock::remove_rect(const Rect& rect)
   }
 }
 
+void _dbBlock::checkNotFrozen(const char* action) const
+{
+  if (_frozen) {
+    getLogger()->error(
+        utl::ODB, 1104, "Cannot {} while block {} is frozen.", action, _name);
+  }
+}
+
 bool _dbBlock::operator==(const _dbBlock& rhs) const
 {
   if (_flags._valid_bbox != rhs._flags._valid_bbox) {
@@ -1773,6 +1783,35 @@ dbBox* dbBlock::getBBox()
   return (dbBox*) bbox;
 }
 
+void dbBlock::freeze()
+{
+  _dbBlock* block = (_dbBlock*) this;
+
+  if (block->_frozen) {
+    return;
+  }
+
+  // Everything below is computed lazily on first access; do it now so that
+  // concurrent readers never write to the block.
+  if (block->_flags._valid_bbox == 0) {
+    ComputeBBox();
+  }
+
+  block->_frozen = true;
+}
+
+void dbBlock::unfreeze()
+{
+  _dbBlock* block = (_dbBlock*) this;
+  block->_frozen = false;
+}
+
+bool dbBlock::isFrozen()
+{
+  _dbBlock* block = (_dbBlock*) this;
+  return block->_frozen;
+}
+
 void dbBlock::ComputeBBox()
 {
   _dbBlock* block = (_dbBlock*) this;
@@ -2147,6 +2186,13 @@ dbNet* dbBlock::findNet(const char* name)
   return (dbNet*) block->_net_hash.find(name);
 }
 
+void dbBlock::reserveNameTables(uint num_insts, uint num_nets)
+{
+  _dbBlock* block = (_dbBlock*) this;
+  block->_inst_hash.reserve(block->_inst_hash._num_entries + num_insts);
+  block->_net_hash.reserve(block->_net_hash._num_entries + num_nets);
+}
+
 bool dbBlock::findSomeMaster(const char* names, std::vector<dbMaster*>& masters)
 {
   if (!names || names[0] == '\0') {
@@ -291,6 +291,9 @@ class _dbBlock : public _dbObject
   dbJournal* _journal;
   dbJournal* _journal_pending;
 
+  // Set by dbBlock::freeze(); edits are rejected while frozen.
+  bool _frozen;
+
   _dbBlock(_dbDatabase* db);
   _dbBlock(_dbDatabase* db, const _dbBlock& block);
   ~_dbBlock();
@@ -298,6 +301,7 @@ class _dbBlock : public _dbObject
   void add_oct(const Oct& oct);
   void remove_rect(const Rect& rect);
   void invalidate_bbox() { _flags._valid_bbox = 0; }
+  void checkNotFrozen(const char* action) const;
   void initialize(_dbChip* chip,
                   _dbTech* tech,
                   _dbBlock* parent,
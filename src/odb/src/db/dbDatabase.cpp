@@ -43,17 +43,36 @@
 #include "dbCCSeg.h"
 #include "dbCapNode.h"
 #include "dbChip.h"
+#include "dbGroup.h"
+#include "dbHashTable.hpp"
 #include "dbITerm.h"
+#include "dbInst.h"
+#include "dbIsolation.h"
 #include "dbJournal.h"
+#include "dbLevelShifter.h"
 #include "dbLib.h"
+#include "dbLogicPort.h"
+#include "dbMTerm.h"
+#include "dbMaster.h"
+#include "dbModBTerm.h"
+#include "dbModITerm.h"
+#include "dbModInst.h"
+#include "dbModNet.h"
+#include "dbModule.h"
 #include "dbNameCache.h"
 #include "dbNet.h"
+#include "dbPowerDomain.h"
+#include "dbPowerSwitch.h"
 #include "dbProperty.h"
 #include "dbPropertyItr.h"
 #include "dbRSeg.h"
+#include "dbSite.h"
 #include "dbTable.h"
 #include "dbTable.hpp"
 #include "dbTech.h"
+#include "dbTechLayer.h"
+#include "dbTechLayerCutClassRule.h"
+#include "dbTechVia.h"
 #include "dbWire.h"
 #include "odb/db.h"
 #include "odb/dbBlockCallBackObj.h"
@@ -286,6 +305,57 @@ dbOStream& operator<<(dbOStream& stream, const _dbDatabase& db)
   return stream;
 }
 
+// Databases before db_schema_hash_table_open_addressing stored chained
+// hash tables; rehash them once every object has been read.
+static void rebuildLegacyHashTables(_dbDatabase& db)
+{
+  db._name_cache->rebuildLegacyHashTable();
+
+  dbSet<_dbTech> techs(&db, db._tech_tbl);
+  for (_dbTech* tech : techs) {
+    tech->_via_hash.rebuildLegacyChains();
+    tech->_name_cache->rebuildLegacyHashTable();
+    dbSet<_dbTechLayer> layers(tech, tech->_layer_tbl);
+    for (_dbTechLayer* layer : layers) {
+      layer->cut_class_rules_hash_.rebuildLegacyChains();
+    }
+  }
+
+  dbSet<_dbLib> libs(&db, db._lib_tbl);
+  for (_dbLib* lib : libs) {
+    lib->_master_hash.rebuildLegacyChains();
+    lib->_site_hash.rebuildLegacyChains();
+    lib->_name_cache->rebuildLegacyHashTable();
+    dbSet<_dbMaster> masters(lib, lib->_master_tbl);
+    for (_dbMaster* master : masters) {
+      master->_mterm_hash.rebuildLegacyChains();
+    }
+  }
+
+  dbSet<_dbChip> chips(&db, db._chip_tbl);
+  for (_dbChip* chip : chips) {
+    chip->_name_cache->rebuildLegacyHashTable();
+    dbSet<_dbBlock> blocks(chip, chip->_block_tbl);
+    for (_dbBlock* block : blocks) {
+      block->_net_hash.rebuildLegacyChains();
+      block->_inst_hash.rebuildLegacyChains();
+      block->_module_hash.rebuildLegacyChains();
+      block->_modinst_hash.rebuildLegacyChains();
+      block->_powerdomain_hash.rebuildLegacyChains();
+      block->_logicport_hash.rebuildLegacyChains();
+      block->_powerswitch_hash.rebuildLegacyChains();
+      block->_isolation_hash.rebuildLegacyChains();
+      block->_modbterm_hash.rebuildLegacyChains();
+      block->_moditerm_hash.rebuildLegacyChains();
+      block->_modnet_hash.rebuildLegacyChains();
+      block->_levelshifter_hash.rebuildLegacyChains();
+      block->_group_hash.rebuildLegacyChains();
+      block->_bterm_hash.rebuildLegacyChains();
+      block->_name_cache->rebuildLegacyHashTable();
+    }
+  }
+}
+
 dbIStream& operator>>(dbIStream& stream, _dbDatabase& db)
 {
   stream >> db._magic1;
@@ -350,6 +420,10 @@ dbIStream& operator>>(dbIStream& stream, _dbDatabase& db)
     }
   }
 
+  if (!db.isSchema(db_schema_hash_table_open_addressing)) {
+    rebuildLegacyHashTables(db);
+  }
+
   // Fix up the owner id of properties of this db, this value changes.
   dbSet<_dbProperty> props(&db, db._prop_tbl);
   dbSet<_dbProperty>::iterator itr;
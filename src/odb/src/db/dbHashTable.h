@@ -32,6 +32,8 @@
 
 #pragma once
 
+#include <vector>
+
 #include "dbPagedVector.h"
 #include "odb/odb.h"
 
@@ -47,11 +49,19 @@ class dbTable;
 ///
 /// dbHashTable - hash table to hash named-objects.
 ///
+/// Open-addressing (linear probing) table. Each slot holds the
+/// object id and the cached hash of its name, so probing only
+/// compares strings on a full hash match and resizing never
+/// rehashes names.
+///
 /// Each object must have the following "named" fields:
 ///
 ///     char *        _name
 ///     dbId<T>       _next_entry
 ///
+/// _next_entry is only used to read the chained tables of
+/// databases older than db_schema_hash_table_open_addressing.
+///
 //////////////////////////////////////////////////////////
 template <class T>
 class dbHashTable
@@ -59,18 +69,26 @@ class dbHashTable
  public:
   enum Params
   {
-    CHAIN_LENGTH = 4
+    MIN_SIZE = 16,
+    // grow above LOAD_NUM / LOAD_DEN full, shrink below 1/4 of that
+    LOAD_NUM = 7,
+    LOAD_DEN = 10
   };
 
   // PERSISTANT-MEMBERS
   dbPagedVector<dbId<T>, 256, 8> _hash_tbl;
+  dbPagedVector<uint, 256, 8> _hash_val;
   uint _num_entries;
 
   // NON-PERSISTANT-MEMBERS
   dbTable<T>* _obj_tbl;
+  std::vector<dbId<T>> _legacy_chains;
 
   void growTable();
   void shrinkTable();
+  void resizeTable(uint size);
+  uint findSlot(const char* name, uint hash) const;
+  void insertSlot(dbId<T> id, uint hash);
 
   dbHashTable();
   dbHashTable(const dbHashTable<T>& table);
@@ -83,10 +101,17 @@ class dbHashTable
   void out(dbDiff& diff, char side, const char* field) const;
 
   void setTable(dbTable<T>* table) { _obj_tbl = table; }
-  T* find(const char* name);
-  int hasMember(const char* name);
+  T* find(const char* name) const;
+  int hasMember(const char* name) const;
   void insert(T* object);
   void remove(T* object);
+
+  // Size the table for num_entries objects so a bulk load does not
+  // trigger repeated resizing.
+  void reserve(uint num_entries);
+
+  // Rebuild the table from the chains of a pre open-addressing database.
+  void rebuildLegacyChains();
 };
 
 template <class T>
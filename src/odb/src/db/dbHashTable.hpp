@@ -32,7 +32,13 @@
 
 #pragma once
 
+#include <algorithm>
+#include <cstring>
+#include <utility>
+#include <vector>
+
 #include "dbCore.h"
+#include "dbDatabase.h"
 #include "dbHashTable.h"
 
 namespace odb {
@@ -58,7 +64,10 @@ dbHashTable<T>::dbHashTable()
 
 template <class T>
 dbHashTable<T>::dbHashTable(const dbHashTable<T>& t)
-    : _hash_tbl(t._hash_tbl), _num_entries(t._num_entries), _obj_tbl(t._obj_tbl)
+    : _hash_tbl(t._hash_tbl),
+      _hash_val(t._hash_val),
+      _num_entries(t._num_entries),
+      _obj_tbl(t._obj_tbl)
 {
 }
 
@@ -78,204 +87,204 @@ bool dbHashTable<T>::operator==(const dbHashTable<T>& rhs) const
     return false;
   }
 
+  if (_hash_val != rhs._hash_val) {
+    return false;
+  }
+
   return true;
 }
 
 template <class T>
-void dbHashTable<T>::growTable()
+void dbHashTable<T>::resizeTable(uint size)
 {
-  uint sz = _hash_tbl.size();
-  dbId<T> entries;
-  uint i;
+  std::vector<std::pair<dbId<T>, uint>> entries;
+  entries.reserve(_num_entries);
 
-  for (i = 0; i < sz; ++i) {
-    dbId<T> cur = _hash_tbl[i];
-
-    while (cur != 0) {
-      T* entry = _obj_tbl->getPtr(cur);
-      dbId<T> next = entry->_next_entry;
-      entry->_next_entry = entries;
-      entries = entry->getOID();
-      cur = next;
+  const uint sz = _hash_tbl.size();
+  for (uint i = 0; i < sz; ++i) {
+    if (_hash_tbl[i] != 0) {
+      entries.emplace_back(_hash_tbl[i], _hash_val[i]);
     }
-
-    _hash_tbl[i] = 0;
   }
 
-  // double the size of the hash-table
-  dbId<T> nullId;
-  for (i = 0; i < sz; ++i) {
-    _hash_tbl.push_back(nullId);
-  }
+  _hash_tbl.clear();
+  _hash_val.clear();
+  _hash_tbl.push_back(size, dbId<T>());
+  _hash_val.push_back(size, 0);
 
-  // reinsert the entries
-  sz = _hash_tbl.size() - 1;
-  dbId<T> cur = entries;
-
-  while (cur != 0) {
-    T* entry = _obj_tbl->getPtr(cur);
-    dbId<T> next = entry->_next_entry;
-    uint hid = hash_string(entry->_name) & sz;
-    dbId<T>& e = _hash_tbl[hid];
-    entry->_next_entry = e;
-    e = entry->getOID();
-    cur = next;
+  // reinsert the entries using the cached hashes
+  for (const auto& [id, hash] : entries) {
+    insertSlot(id, hash);
   }
 }
 
 template <class T>
-void dbHashTable<T>::shrinkTable()
+void dbHashTable<T>::growTable()
 {
-  uint sz = _hash_tbl.size();
-  dbId<T> entries;
-  uint i;
+  const uint sz = _hash_tbl.size();
+  resizeTable(sz == 0 ? MIN_SIZE : sz << 1);
+}
 
-  for (i = 0; i < sz; ++i) {
-    dbId<T> cur = _hash_tbl[i];
+template <class T>
+void dbHashTable<T>::shrinkTable()
+{
+  resizeTable(_hash_tbl.size() >> 1);
+}
 
-    while (cur != 0) {
-      T* entry = _obj_tbl->getPtr(cur);
-      dbId<T> next = entry->_next_entry;
-      entry->_next_entry = entries;
-      entries = entry->getOID();
-      cur = next;
-    }
+template <class T>
+void dbHashTable<T>::reserve(uint num_entries)
+{
+  uint sz = std::max<uint>(_hash_tbl.size(), MIN_SIZE);
+  while ((uint64_t) num_entries * LOAD_DEN > (uint64_t) sz * LOAD_NUM) {
+    sz <<= 1;
+  }
 
-    _hash_tbl[i] = 0;
+  if (sz != _hash_tbl.size()) {
+    resizeTable(sz);
   }
+}
 
-  // TODO: add method to dbPagedVector to resize the table
-  _hash_tbl.clear();
-  sz >>= 1;
+template <class T>
+void dbHashTable<T>::insertSlot(dbId<T> id, uint hash)
+{
+  const uint mask = _hash_tbl.size() - 1;
+  uint slot = hash & mask;
 
-  // halve the size of the hash-table
-  dbId<T> nullId;
-  for (i = 0; i < sz; ++i) {
-    _hash_tbl.push_back(nullId);
+  while (_hash_tbl[slot] != 0) {
+    slot = (slot + 1) & mask;
   }
 
-  sz -= 1;
-  // reinsert the entries
-  dbId<T> cur = entries;
-
-  while (cur != 0) {
-    T* entry = _obj_tbl->getPtr(cur);
-    dbId<T> next = entry->_next_entry;
-    uint hid = hash_string(entry->_name) & sz;
-    dbId<T>& e = _hash_tbl[hid];
-    entry->_next_entry = e;
-    e = entry->getOID();
-    cur = next;
-  }
+  _hash_tbl[slot] = id;
+  _hash_val[slot] = hash;
 }
 
+// Returns the slot holding name, or the table size if it is not present.
 template <class T>
-void dbHashTable<T>::insert(T* object)
+uint dbHashTable<T>::findSlot(const char* name, uint hash) const
 {
-  ++_num_entries;
-  uint sz = _hash_tbl.size();
+  const uint sz = _hash_tbl.size();
 
   if (sz == 0) {
-    dbId<T> nullId;
-    _hash_tbl.push_back(nullId);
-    sz = 1;
-  } else {
-    uint r = _num_entries / sz;
+    return sz;
+  }
+
+  const uint mask = sz - 1;
+  uint slot = hash & mask;
 
-    if (r > CHAIN_LENGTH) {
-      growTable();
-      sz = _hash_tbl.size();
+  while (true) {
+    const dbId<T> cur = _hash_tbl[slot];
+
+    if (cur == 0) {
+      return sz;
+    }
+
+    if (_hash_val[slot] == hash) {
+      const T* entry = _obj_tbl->getPtr(cur);
+
+      if (strcmp(entry->_name, name) == 0) {
+        return slot;
+      }
     }
-  }
 
-  uint hid = hash_string(object->_name) & (sz - 1);
-  dbId<T>& e = _hash_tbl[hid];
-  object->_next_entry = e;
-  e = object->getOID();
+    slot = (slot + 1) & mask;
+  }
 }
 
 template <class T>
-T* dbHashTable<T>::find(const char* name)
+void dbHashTable<T>::insert(T* object)
 {
-  uint sz = _hash_tbl.size();
+  ++_num_entries;
 
-  if (sz == 0) {
-    return 0;
+  if ((uint64_t) _num_entries * LOAD_DEN
+      > (uint64_t) _hash_tbl.size() * LOAD_NUM) {
+    growTable();
   }
 
-  uint hid = hash_string(name) & (sz - 1);
-  dbId<T> cur = _hash_tbl[hid];
-
-  while (cur != 0) {
-    T* entry = _obj_tbl->getPtr(cur);
+  insertSlot(object->getOID(), hash_string(object->_name));
+}
 
-    if (strcmp(entry->_name, name) == 0) {
-      return entry;
-    }
+template <class T>
+T* dbHashTable<T>::find(const char* name) const
+{
+  const uint slot = findSlot(name, hash_string(name));
 
-    cur = entry->_next_entry;
+  if (slot == _hash_tbl.size()) {
+    return nullptr;
   }
 
-  return nullptr;
+  return _obj_tbl->getPtr(_hash_tbl[slot]);
 }
 
 template <class T>
-int dbHashTable<T>::hasMember(const char* name)
+int dbHashTable<T>::hasMember(const char* name) const
 {
-  uint sz = _hash_tbl.size();
+  return findSlot(name, hash_string(name)) != _hash_tbl.size();
+}
+
+template <class T>
+void dbHashTable<T>::remove(T* object)
+{
+  const uint sz = _hash_tbl.size();
 
   if (sz == 0) {
-    return false;
+    return;
   }
 
-  uint hid = hash_string(name) & (sz - 1);
-  dbId<T> cur = _hash_tbl[hid];
+  const uint mask = sz - 1;
+  const dbId<T> id = object->getOID();
+  uint slot = hash_string(object->_name) & mask;
 
-  while (cur != 0) {
-    T* entry = _obj_tbl->getPtr(cur);
-
-    if (strcmp(entry->_name, name) == 0) {
-      return true;
+  while (_hash_tbl[slot] != id) {
+    if (_hash_tbl[slot] == 0) {
+      return;
     }
+    slot = (slot + 1) & mask;
+  }
 
-    cur = entry->_next_entry;
+  // Backward-shift deletion: move later entries of the probe sequence
+  // into the hole so lookups never need tombstones.
+  uint hole = slot;
+  uint next = (hole + 1) & mask;
+
+  while (_hash_tbl[next] != 0) {
+    const uint home = _hash_val[next] & mask;
+    // distance of each slot from the entry's home slot
+    if (((next - home) & mask) >= ((next - hole) & mask)) {
+      _hash_tbl[hole] = _hash_tbl[next];
+      _hash_val[hole] = _hash_val[next];
+      hole = next;
+    }
+    next = (next + 1) & mask;
   }
 
-  return false;
+  _hash_tbl[hole] = 0;
+  _hash_val[hole] = 0;
+  --_num_entries;
+
+  if (sz > MIN_SIZE
+      && (uint64_t) _num_entries * LOAD_DEN * 4 < (uint64_t) sz * LOAD_NUM) {
+    shrinkTable();
+  }
 }
 
 template <class T>
-void dbHashTable<T>::remove(T* object)
+void dbHashTable<T>::rebuildLegacyChains()
 {
-  uint sz = _hash_tbl.size();
-  uint hid = hash_string(object->_name) & (sz - 1);
-  dbId<T> cur = _hash_tbl[hid];
-  dbId<T> prev;
-
-  while (cur != 0) {
-    T* entry = _obj_tbl->getPtr(cur);
-
-    if (entry == object) {
-      if (prev == 0) {
-        _hash_tbl[hid] = entry->_next_entry;
-      } else {
-        T* p = _obj_tbl->getPtr(prev);
-        p->_next_entry = entry->_next_entry;
-      }
-
-      --_num_entries;
-
-      uint r = (_num_entries + _num_entries / 10) / sz;
+  std::vector<dbId<T>> chains;
+  chains.swap(_legacy_chains);
+  _hash_tbl.clear();
+  _hash_val.clear();
 
-      if ((r < (CHAIN_LENGTH >> 1)) && (sz > 1)) {
-        shrinkTable();
-      }
+  const uint num_entries = _num_entries;
+  _num_entries = 0;
+  reserve(num_entries);
 
-      return;
+  for (dbId<T> cur : chains) {
+    while (cur != 0) {
+      T* entry = _obj_tbl->getPtr(cur);
+      insert(entry);
+      cur = entry->_next_entry;
     }
-
-    prev = cur;
-    cur = entry->_next_entry;
   }
 }
 
@@ -283,6 +292,7 @@ template <class T>
 dbOStream& operator<<(dbOStream& stream, const dbHashTable<T>& table)
 {
   stream << table._hash_tbl;
+  stream << table._hash_val;
   stream << table._num_entries;
   return stream;
 }
@@ -290,8 +300,25 @@ dbOStream& operator<<(dbOStream& stream, const dbHashTable<T>& table)
 template <class T>
 dbIStream& operator>>(dbIStream& stream, dbHashTable<T>& table)
 {
-  stream >> table._hash_tbl;
-  stream >> table._num_entries;
+  if (stream.getDatabase()->isSchema(db_schema_hash_table_open_addressing)) {
+    stream >> table._hash_tbl;
+    stream >> table._hash_val;
+    stream >> table._num_entries;
+  } else {
+    // Chained buckets; the entries are rehashed by rebuildLegacyChains()
+    // once the objects themselves have been read.
+    dbPagedVector<dbId<T>, 256, 8> buckets;
+    stream >> buckets;
+    stream >> table._num_entries;
+    table._hash_tbl.clear();
+    table._hash_val.clear();
+    table._legacy_chains.clear();
+    for (uint i = 0; i < buckets.size(); ++i) {
+      if (buckets[i] != 0) {
+        table._legacy_chains.push_back(buckets[i]);
+      }
+    }
+  }
   return stream;
 }
 
@@ -304,6 +331,7 @@ void dbHashTable<T>::differences(dbDiff& diff,
   diff.increment();
   DIFF_FIELD(_num_entries)
   DIFF_VECTOR(_hash_tbl);
+  DIFF_VECTOR(_hash_val);
   diff.decrement();
 }
 
@@ -314,6 +342,7 @@ void dbHashTable<T>::out(dbDiff& diff, char side, const char* field) const
   diff.increment();
   DIFF_OUT_FIELD(_num_entries)
   DIFF_OUT_VECTOR(_hash_tbl);
+  DIFF_OUT_VECTOR(_hash_val);
   diff.decrement();
 }
 
@@ -384,6 +384,7 @@ void dbITerm::connect(dbNet* net_)
   _dbITerm* iterm = (_dbITerm*) this;
   _dbNet* net = (_dbNet*) net_;
   _dbBlock* block = (_dbBlock*) iterm->getOwner();
+  block->checkNotFrozen("connect iterm");
 
   _dbInst* inst = iterm->getInst();
   if (!net_) {
@@ -516,6 +517,8 @@ void dbITerm::disconnect()
     return;
   }
 
+  ((_dbBlock*) iterm->getOwner())->checkNotFrozen("disconnect iterm");
+
   _dbInst* inst = iterm->getInst();
   if (inst->_flags._dont_touch) {
     inst->getLogger()->error(
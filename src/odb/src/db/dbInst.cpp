@@ -479,6 +479,7 @@ bool dbInst::rename(const char* name)
 {
   _dbInst* inst = (_dbInst*) this;
   _dbBlock* block = (_dbBlock*) inst->getOwner();
+  block->checkNotFrozen("rename instance");
 
   if (block->_inst_hash.hasMember(name)) {
     return false;
@@ -508,6 +509,7 @@ void dbInst::setOrigin(int x, int y)
   if (block->_flags._valid_bbox && prev_x == x && prev_y == y) {
     return;
   }
+  block->checkNotFrozen("move instance");
   if (getPlacementStatus().isFixed()) {
     inst->getLogger()->error(utl::ODB,
                              359,
@@ -604,6 +606,7 @@ void dbInst::setOrient(dbOrientType orient)
   }
   _dbInst* inst = (_dbInst*) this;
   _dbBlock* block = (_dbBlock*) inst->getOwner();
+  block->checkNotFrozen("change instance orientation");
 
   if (getPlacementStatus().isFixed()) {
     inst->getLogger()->error(
@@ -651,6 +654,7 @@ void dbInst::setPlacementStatus(dbPlacementStatus status)
   if (inst->_flags._status == status) {
     return;
   }
+  block->checkNotFrozen("change instance placement status");
 
   for (auto callback : block->_callbacks) {
     callback->inDbInstPlacementStatusBefore(this, status);
@@ -1210,6 +1214,7 @@ bool dbInst::swapMaster(dbMaster* new_master_)
 
   _dbInst* inst = (_dbInst*) this;
   _dbBlock* block = (_dbBlock*) inst->getOwner();
+  block->checkNotFrozen("swap instance master");
   dbMaster* old_master_ = getMaster();
 
   if (inst->_flags._dont_touch) {
@@ -1390,6 +1395,7 @@ dbInst* dbInst::create(dbBlock* block_,
                        dbModule* parent_module)
 {
   _dbBlock* block = (_dbBlock*) block_;
+  block->checkNotFrozen("create instance");
   _dbMaster* master = (_dbMaster*) master_;
   _dbInstHdr* inst_hdr = block->_inst_hdr_hash.find(master->_id);
   if (inst_hdr == nullptr) {
@@ -1536,6 +1542,7 @@ void dbInst::destroy(dbInst* inst_)
 {
   _dbInst* inst = (_dbInst*) inst_;
   _dbBlock* block = (_dbBlock*) inst->getOwner();
+  block->checkNotFrozen("destroy instance");
 
   if (inst->_flags._dont_touch) {
     inst->getLogger()->error(utl::ODB,
@@ -239,6 +239,11 @@ const char* _dbNameCache::getName(uint id)
   return n->_name;
 }
 
+void _dbNameCache::rebuildLegacyHashTable()
+{
+  _name_hash.rebuildLegacyChains();
+}
+
 dbOStream& operator<<(dbOStream& stream, const _dbNameCache& cache)
 {
   stream << cache._name_hash;
@@ -73,6 +73,9 @@ class _dbNameCache
 
   // Remove the string this id represents
   const char* getName(uint id);
+
+  // Rehash the names read from a pre open-addressing database
+  void rebuildLegacyHashTable();
 };
 
 dbOStream& operator<<(dbOStream& stream, const _dbNameCache& net);
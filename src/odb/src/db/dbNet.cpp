@@ -712,6 +712,7 @@ bool dbNet::rename(const char* name)
 {
   _dbNet* net = (_dbNet*) this;
   _dbBlock* block = (_dbBlock*) net->getOwner();
+  block->checkNotFrozen("rename net");
 
   if (block->_net_hash.hasMember(name)) {
     return false;
@@ -3070,6 +3071,7 @@ void dbNet::destroySWires()
 dbNet* dbNet::create(dbBlock* block_, const char* name_, bool skipExistingCheck)
 {
   _dbBlock* block = (_dbBlock*) block_;
+  block->checkNotFrozen("create net");
 
   if (!skipExistingCheck && block->_net_hash.hasMember(name_)) {
     return nullptr;
@@ -3106,6 +3108,7 @@ void dbNet::destroy(dbNet* net_)
 {
   _dbNet* net = (_dbNet*) net_;
   _dbBlock* block = (_dbBlock*) net->getOwner();
+  block->checkNotFrozen("destroy net");
 
   if (net->_flags._dont_touch) {
     net->getLogger()->error(
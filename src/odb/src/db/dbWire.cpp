@@ -1788,6 +1788,7 @@ dbWire* dbWire::create(dbNet* net_, bool global_wire)
   }
 
   _dbBlock* block = (_dbBlock*) net->getOwner();
+  block->checkNotFrozen("create wire");
   _dbWire* wire = block->_wire_tbl->create();
   wire->_net = net->getOID();
 
@@ -1809,6 +1810,7 @@ dbWire* dbWire::create(dbNet* net_, bool global_wire)
 dbWire* dbWire::create(dbBlock* block_, bool /* unused: global_wire */)
 {
   _dbBlock* block = (_dbBlock*) block_;
+  block->checkNotFrozen("create wire");
   _dbWire* wire = block->_wire_tbl->create();
   for (auto callback : block->_callbacks) {
     callback->inDbWireCreate((dbWire*) wire);
@@ -1826,6 +1828,7 @@ void dbWire::destroy(dbWire* wire_)
 {
   _dbWire* wire = (_dbWire*) wire_;
   _dbBlock* block = (_dbBlock*) wire->getOwner();
+  block->checkNotFrozen("destroy wire");
   _dbNet* net = (_dbNet*) wire_->getNet();
   for (auto callback : block->_callbacks) {
     callback->inDbWireDestroy(wire_);
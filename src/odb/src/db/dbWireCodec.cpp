@@ -604,6 +604,8 @@ void dbWireEncoder::end()
     return;
   }
 
+  ((_dbBlock*) _block)->checkNotFrozen("encode wire");
+
   uint n = _opcodes.size();
 
   // Free the old memory
@@ -0,0 +1,149 @@
+///////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2024, The Regents of the University of California
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#include "dbWire.h"
+#include "odb/db.h"
+#include "odb/dbShape.h"
+#include "odb/dbWireCodec.h"
+
+namespace odb {
+
+////////////////////////////////////////////////////////////////////////////////
+//
+// dbWireShapeIndex
+//
+////////////////////////////////////////////////////////////////////////////////
+void dbWireShapeIndex::build(dbWire* wire)
+{
+  clear();
+
+  const int length = ((_dbWire*) wire)->length();
+  _shape_idx.assign(length, -1);
+  _points.resize(length);
+  _has_point.assign(length, false);
+
+  dbShape shape;
+  dbWireShapeItr shapes;
+  for (shapes.begin(wire); shapes.next(shape);) {
+    const int idx = _shapes.size();
+    _shape_idx[shapes.getShapeId()] = idx;
+    _shape_ids.push_back(shapes.getShapeId());
+    _shapes.push_back(shape);
+
+    switch (shape.getType()) {
+      case dbShape::VIA: {
+        dbVia* via = shape.getVia();
+        addLayerShape(via->getBottomLayer(), idx);
+        addLayerShape(via->getTopLayer(), idx);
+        break;
+      }
+      case dbShape::TECH_VIA: {
+        dbTechVia* via = shape.getTechVia();
+        addLayerShape(via->getBottomLayer(), idx);
+        addLayerShape(via->getTopLayer(), idx);
+        break;
+      }
+      default:
+        addLayerShape(shape.getTechLayer(), idx);
+        break;
+    }
+  }
+
+  dbWireDecoder decoder;
+  decoder.begin(wire);
+  for (auto opcode = decoder.next(); opcode != dbWireDecoder::END_DECODE;
+       opcode = decoder.next()) {
+    switch (opcode) {
+      case dbWireDecoder::POINT:
+      case dbWireDecoder::POINT_EXT:
+      case dbWireDecoder::VIA:
+      case dbWireDecoder::TECH_VIA: {
+        const int jid = decoder.getJunctionId();
+        int x, y;
+        decoder.getPoint(x, y);
+        _points[jid] = Point(x, y);
+        _has_point[jid] = true;
+        break;
+      }
+      default:
+        break;
+    }
+  }
+}
+
+void dbWireShapeIndex::clear()
+{
+  _shapes.clear();
+  _shape_ids.clear();
+  _shape_idx.clear();
+  _points.clear();
+  _has_point.clear();
+  _layer_shapes.clear();
+}
+
+void dbWireShapeIndex::addLayerShape(dbTechLayer* layer, int idx)
+{
+  if (layer) {
+    _layer_shapes[layer].push_back(idx);
+  }
+}
+
+bool dbWireShapeIndex::getShape(int shape_id, dbShape& shape) const
+{
+  if (shape_id < 0 || shape_id >= (int) _shape_idx.size()
+      || _shape_idx[shape_id] < 0) {
+    return false;
+  }
+  shape = _shapes[_shape_idx[shape_id]];
+  return true;
+}
+
+bool dbWireShapeIndex::getCoord(int jid, Point& point) const
+{
+  if (jid < 0 || jid >= (int) _has_point.size() || !_has_point[jid]) {
+    return false;
+  }
+  point = _points[jid];
+  return true;
+}
+
+const std::vector<int>& dbWireShapeIndex::getLayerShapes(
+    dbTechLayer* layer) const
+{
+  auto it = _layer_shapes.find(layer);
+  if (it == _layer_shapes.end()) {
+    return _no_shapes;
+  }
+  return it->second;
+}
+
+}  // namespace odb
@@ -41,6 +41,7 @@
 #include "definBlockage.h"
 #include "definComponent.h"
 #include "definComponentMaskShift.h"
+#include "definScanner.h"
 #include "definFill.h"
 #include "definGCell.h"
 #include "definGroup.h"
@@ -78,6 +79,7 @@ definReader::definReader(dbDatabase* db, utl::Logger* logger, defin::MODE mode)
   _block_name = nullptr;
   parent_ = nullptr;
   _continue_on_errors = false;
+  threads_ = 1;
   version_ = nullptr;
   hier_delimeter_ = 0;
   left_bus_delimeter_ = 0;
@@ -191,6 +193,11 @@ void definReader::continueOnErrors()
   _continue_on_errors = true;
 }
 
+void definReader::setThreadCount(int threads)
+{
+  threads_ = threads;
+}
+
 void definReader::replaceWires()
 {
   _netR->replaceWires();
@@ -462,6 +469,48 @@ int definReader::blockageCallback(defrCallbackType_e /* unused: type */,
   return PARSE_OK;
 }
 
+int definReader::componentsStartCallback(
+    defrCallbackType_e /* unused: type */,
+    int number,
+    defiUserData data)
+{
+  definReader* reader = (definReader*) data;
+  CHECKBLOCK
+  if (reader->_mode == defin::DEFAULT && number > 0) {
+    reader->_block->reserveNameTables(number, 0);
+  }
+  if (reader->scanner_) {
+    reader->createScannedComponents();
+  }
+  return PARSE_OK;
+}
+
+// The statements were tokenized up front by definScanner; create them in
+// file order exactly as componentsCallback would.
+void definReader::createScannedComponents()
+{
+  for (const auto& comp : scanner_->getComponents()) {
+    _componentR->begin(comp.name.c_str(), comp.cell.c_str());
+    if (!comp.source.empty()) {
+      _componentR->source(dbSourceType(comp.source.c_str()));
+    }
+    if (comp.has_weight) {
+      _componentR->weight(comp.weight);
+    }
+    if (!comp.region.empty()) {
+      _componentR->region(comp.region.c_str());
+    }
+    if (comp.has_halo) {
+      _componentR->halo(
+          comp.halo[0], comp.halo[1], comp.halo[2], comp.halo[3]);
+    }
+    _componentR->placement(comp.status, comp.x, comp.y, comp.orient);
+    _componentR->end();
+  }
+  // The scanner keeps serving the file to Si2; only drop the records.
+  scanner_->clearComponents();
+}
+
 int definReader::componentsCallback(defrCallbackType_e /* unused: type */,
                                     defiComponent* comp,
                                     defiUserData data)
@@ -708,6 +757,131 @@ int definReader::historyCallback(defrCallbackType_e /* unused: type */,
   return PARSE_OK;
 }
 
+int definReader::netsStartCallback(defrCallbackType_e /* unused: type */,
+                                   int number,
+                                   defiUserData data)
+{
+  definReader* reader = (definReader*) data;
+  CHECKBLOCK
+  if (reader->_mode == defin::DEFAULT && number > 0) {
+    reader->_block->reserveNameTables(0, number);
+  }
+  if (reader->scanner_) {
+    reader->createScannedNets();
+  }
+  return PARSE_OK;
+}
+
+// Replays the scanned NETS statements as netCallback would; the scanner
+// only accepts the constructs netCallback supports.
+void definReader::createScannedNets()
+{
+  using Scanner = definScanner;
+  for (const Scanner::Net& net : scanner_->getNets()) {
+    _netR->begin(std::string(net.name).c_str());
+
+    if (!net.use.empty()) {
+      _netR->use(dbSigType(std::string(net.use).c_str()));
+    }
+
+    if (!net.source.empty()) {
+      _netR->source(dbSourceType(std::string(net.source).c_str()));
+    }
+
+    if (net.fixedbump) {
+      _netR->fixedbump();
+    }
+
+    if (net.has_weight) {
+      _netR->weight(net.weight);
+    }
+
+    if (!net.non_default_rule.empty()) {
+      _netR->nonDefaultRule(std::string(net.non_default_rule).c_str());
+    }
+
+    for (const Scanner::Connection& conn : net.connections) {
+      _netR->connection(std::string(conn.inst).c_str(),
+                        std::string(conn.pin).c_str());
+    }
+
+    for (const Scanner::Wire& wire : net.wires) {
+      _netR->wire(dbWireType(std::string(wire.type).c_str()));
+
+      for (const auto& path : wire.paths) {
+        for (size_t i = 0; i < path.size(); ++i) {
+          const Scanner::PathItem& item = path[i];
+          const Scanner::PathItem* next
+              = i + 1 < path.size() ? &path[i + 1] : nullptr;
+          switch (item.type) {
+            case Scanner::LAYER: {
+              const std::string layer(item.name);
+              if (next && next->type == Scanner::TAPER) {
+                _netR->pathTaper(layer.c_str());
+                ++i;
+              } else if (next && next->type == Scanner::TAPERRULE) {
+                _netR->pathTaperRule(layer.c_str(),
+                                     std::string(next->name).c_str());
+                ++i;
+              } else {
+                _netR->path(layer.c_str());
+              }
+              break;
+            }
+
+            case Scanner::VIA: {
+              const std::string via(item.name);
+              if (next && next->type == Scanner::VIAROTATION) {
+                _netR->pathVia(via.c_str(),
+                               translate_orientation(next->values[0]));
+                ++i;
+              } else {
+                _netR->pathVia(via.c_str());
+              }
+              break;
+            }
+
+            case Scanner::POINT:
+              _netR->pathPoint(item.values[0], item.values[1]);
+              break;
+
+            case Scanner::FLUSHPOINT:
+              _netR->pathPoint(item.values[0], item.values[1], item.values[2]);
+              break;
+
+            case Scanner::RECT:
+              _netR->pathRect(item.values[0],
+                              item.values[1],
+                              item.values[2],
+                              item.values[3]);
+              break;
+
+            case Scanner::MASK:
+              _netR->pathColor(item.values[0]);
+              break;
+
+            case Scanner::VIAMASK:
+              _netR->pathViaColor(item.values[0] % 10,
+                                  item.values[0] / 10 % 10,
+                                  item.values[0] / 100);
+              break;
+
+            default:
+              // Not produced by the scanner for regular nets.
+              break;
+          }
+        }
+        _netR->pathEnd();
+      }
+
+      _netR->wireEnd();
+    }
+
+    _netR->end();
+  }
+  scanner_->clearNets();
+}
+
 int definReader::netCallback(defrCallbackType_e /* unused: type */,
                              defiNet* net,
                              defiUserData data)
@@ -1481,6 +1655,130 @@ int definReader::viaCallback(defrCallbackType_e /* unused: type */,
   return PARSE_OK;
 }
 
+int definReader::specialNetsStartCallback(
+    defrCallbackType_e /* unused: type */,
+    int /* unused: number */,
+    defiUserData data)
+{
+  definReader* reader = (definReader*) data;
+  CHECKBLOCK
+  if (reader->scanner_) {
+    reader->createScannedSpecialNets();
+  }
+  return PARSE_OK;
+}
+
+// Replays the scanned SPECIALNETS statements as specialNetCallback would.
+void definReader::createScannedSpecialNets()
+{
+  using Scanner = definScanner;
+  for (const Scanner::Net& net : scanner_->getSpecialNets()) {
+    _snetR->begin(std::string(net.name).c_str());
+
+    if (!net.use.empty()) {
+      _snetR->use(dbSigType(std::string(net.use).c_str()));
+    }
+
+    if (!net.source.empty()) {
+      _snetR->source(dbSourceType(std::string(net.source).c_str()));
+    }
+
+    if (net.fixedbump) {
+      _snetR->fixedbump();
+    }
+
+    if (net.has_weight) {
+      _snetR->weight(net.weight);
+    }
+
+    for (const Scanner::Connection& conn : net.connections) {
+      _snetR->connection(std::string(conn.inst).c_str(),
+                         std::string(conn.pin).c_str(),
+                         conn.synthesized);
+    }
+
+    for (const Scanner::Wire& wire : net.wires) {
+      _snetR->wire(dbWireType(std::string(wire.type).c_str()), nullptr);
+
+      for (const auto& path : wire.paths) {
+        std::string layerName;
+        uint next_mask = 0;
+        uint next_via_bottom_mask = 0;
+        uint next_via_cut_mask = 0;
+        uint next_via_top_mask = 0;
+        for (size_t i = 0; i < path.size(); ++i) {
+          const Scanner::PathItem& item = path[i];
+          switch (item.type) {
+            case Scanner::LAYER:
+              layerName = item.name;
+              break;
+
+            case Scanner::VIA: {
+              const std::string via(item.name);
+              if (i + 1 < path.size() && path[i + 1].type == Scanner::VIADATA) {
+                const int* data = path[++i].values;
+                _snetR->pathViaArray(
+                    via.c_str(), data[0], data[1], data[2], data[3]);
+              } else {
+                _snetR->pathVia(via.c_str(),
+                                next_via_bottom_mask,
+                                next_via_cut_mask,
+                                next_via_top_mask);
+              }
+              break;
+            }
+
+            case Scanner::WIDTH:
+              _snetR->path(layerName.c_str(), item.values[0]);
+              break;
+
+            case Scanner::POINT:
+              _snetR->pathPoint(item.values[0], item.values[1], next_mask);
+              break;
+
+            case Scanner::FLUSHPOINT:
+              _snetR->pathPoint(
+                  item.values[0], item.values[1], item.values[2], next_mask);
+              break;
+
+            case Scanner::SHAPE:
+              _snetR->pathShape(std::string(item.name).c_str());
+              break;
+
+            case Scanner::MASK:
+              next_mask = item.values[0];
+              break;
+
+            case Scanner::VIAMASK:
+              next_via_bottom_mask = item.values[0] % 10;
+              next_via_cut_mask = item.values[0] / 10 % 10;
+              next_via_top_mask = item.values[0] / 100;
+              break;
+
+            default:
+              // Not produced by the scanner for special nets.
+              break;
+          }
+          if (item.type != Scanner::MASK) {
+            next_mask = 0;
+          }
+          if (item.type != Scanner::VIAMASK) {
+            next_via_bottom_mask = 0;
+            next_via_cut_mask = 0;
+            next_via_top_mask = 0;
+          }
+        }
+        _snetR->pathEnd();
+      }
+
+      _snetR->wireEnd();
+    }
+
+    _snetR->end();
+  }
+  scanner_->clearSpecialNets();
+}
+
 int definReader::specialNetCallback(defrCallbackType_e /* unused: type */,
                                     defiNet* net,
                                     defiUserData data)
@@ -1863,6 +2161,7 @@ bool definReader::createBlock(const char* file)
   defrSetDividerCbk(divideCharCallback);
   defrSetDesignCbk(designCallback);
   defrSetUnitsCbk(unitsCallback);
+  defrSetComponentStartCbk(componentsStartCallback);
   defrSetComponentCbk(componentsCallback);
   defrSetComponentMaskShiftLayerCbk(componentMaskShiftCallback);
   defrSetPinCbk(pinCallback);
@@ -1873,7 +2172,9 @@ bool definReader::createBlock(const char* file)
     defrSetDieAreaCbk(dieAreaCallback);
     defrSetTrackCbk(trackCallback);
     defrSetRowCbk(rowCallback);
+    defrSetNetStartCbk(netsStartCallback);
     defrSetNetCbk(netCallback);
+    defrSetSNetStartCbk(specialNetsStartCallback);
     defrSetSNetCbk(specialNetCallback);
     defrSetViaCbk(viaCallback);
     defrSetBlockageCbk(blockageCallback);
@@ -1914,7 +2215,33 @@ bool definReader::createBlock(const char* file)
       _logger->warn(utl::ODB, 148, "error: Cannot open DEF file {}", file);
       return false;
     }
-    res = defrRead(f, file, (defiUserData) this, /* case sensitive */ 1);
+    // Tokenize COMPONENTS, SPECIALNETS and NETS in parallel and let Si2
+    // parse the rest of the file; the statements are created from the
+    // section start callbacks so the creation order is unchanged.
+    if (threads_ > 1 && _mode == defin::DEFAULT) {
+      scanner_ = std::make_unique<definScanner>();
+      if (scanner_->scan(file, threads_)) {
+        debugPrint(_logger,
+                   utl::ODB,
+                   "defin",
+                   1,
+                   "Scanned {} components, {} special nets and {} nets with "
+                   "{} threads.",
+                   scanner_->getComponents().size(),
+                   scanner_->getSpecialNets().size(),
+                   scanner_->getNets().size(),
+                   threads_);
+        defrSetReadFunction(definScanner::read);
+      } else {
+        scanner_.reset();
+      }
+    }
+    FILE* input = scanner_ ? scanner_->getFile() : f;
+    res = defrRead(input, file, (defiUserData) this, /* case sensitive */ 1);
+    if (scanner_) {
+      defrUnsetReadFunction();
+      scanner_.reset();
+    }
     fclose(f);
   } else {
     defrSetGZipReadFunction();
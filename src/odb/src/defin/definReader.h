@@ -32,6 +32,8 @@
 
 #pragma once
 
+#include <memory>
+
 #include "definBase.h"
 #include "defrReader.hpp"
 #include "odb/odb.h"
@@ -58,6 +60,7 @@ class definGroup;
 class definNonDefaultRule;
 class definPropDefs;
 class definPinProps;
+class definScanner;
 
 class definReader : public definBase
 {
@@ -87,9 +90,14 @@ class definReader : public definBase
   char hier_delimeter_;
   char left_bus_delimeter_;
   char right_bus_delimeter_;
+  int threads_;
+  std::unique_ptr<definScanner> scanner_;
 
   void init();
   void setLibs(std::vector<dbLib*>& lib_names);
+  void createScannedComponents();
+  void createScannedNets();
+  void createScannedSpecialNets();
 
   virtual void error(const char* msg);
   virtual void line(int line_num);
@@ -108,6 +116,9 @@ class definReader : public definBase
                               defiBlockage* blockage,
                               defiUserData data);
 
+  static int componentsStartCallback(defrCallbackType_e type,
+                                     int number,
+                                     defiUserData data);
   static int componentsCallback(defrCallbackType_e type,
                                 defiComponent* comp,
                                 defiUserData data);
@@ -152,6 +163,9 @@ class definReader : public definBase
                              const char* extension,
                              defiUserData data);
 
+  static int netsStartCallback(defrCallbackType_e type,
+                               int number,
+                               defiUserData data);
   static int netCallback(defrCallbackType_e type,
                          defiNet* net,
                          defiUserData data);
@@ -202,6 +216,9 @@ class definReader : public definBase
                            int count,
                            defiUserData data);
 
+  static int specialNetsStartCallback(defrCallbackType_e type,
+                                      int number,
+                                      defiUserData data);
   static int specialNetCallback(defrCallbackType_e type,
                                 defiNet* net,
                                 defiUserData data);
@@ -255,6 +272,7 @@ class definReader : public definBase
   void skipBlockWires();
   void skipFillWires();
   void continueOnErrors();
+  void setThreadCount(int threads);
   void useBlockName(const char* name);
   void namesAreDBIDs();
   void setAssemblyMode();
@@ -0,0 +1,989 @@
+///////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2024, The Regents of the University of California
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#include "definScanner.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <climits>
+#include <cstdlib>
+#include <cstring>
+#include <initializer_list>
+#include <iterator>
+
+#include "defiComponent.hpp"
+#include "defiUtil.hpp"
+
+namespace odb {
+
+namespace {
+
+// Below this many bytes per thread the section is not worth splitting.
+constexpr size_t min_chunk_size = 1 << 20;
+
+// The characters the Si2 lexer separates tokens with.
+bool isSpace(char c)
+{
+  return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+}
+
+// Whitespace separated tokenizer that skips '#' comments.  Tokens the
+// Si2 lexer treats specially (quoted strings, &alias, non-ASCII) are
+// flagged so the chunk is left to Si2.
+class Tokenizer
+{
+ public:
+  Tokenizer(const char* begin, const char* end) : p_(begin), end_(end) {}
+
+  bool atEnd()
+  {
+    skip();
+    return p_ == end_;
+  }
+
+  std::string_view next()
+  {
+    skip();
+    const char* start = p_;
+    while (p_ != end_ && !isSpace(*p_)) {
+      if (static_cast<unsigned char>(*p_) > 127) {
+        ok_ = false;
+      }
+      ++p_;
+    }
+    if (p_ != start && (*start == '"' || *start == '&')) {
+      ok_ = false;
+    }
+    return {start, static_cast<size_t>(p_ - start)};
+  }
+
+  std::string_view peek()
+  {
+    const char* save = p_;
+    std::string_view token = next();
+    p_ = save;
+    return token;
+  }
+
+  const char* pos() const { return p_; }
+  bool ok() const { return ok_; }
+
+ private:
+  void skip()
+  {
+    while (p_ != end_) {
+      if (isSpace(*p_)) {
+        ++p_;
+      } else if (*p_ == '#') {
+        while (p_ != end_ && *p_ != '\n') {
+          ++p_;
+        }
+      } else {
+        break;
+      }
+    }
+  }
+
+  const char* p_;
+  const char* end_;
+  bool ok_ = true;
+};
+
+// A NUMBER token as the Si2 lexer reads it.
+bool parseNumber(std::string_view token, double& number)
+{
+  if (token.empty()
+      || !(isdigit(static_cast<unsigned char>(token[0])) || token[0] == '.'
+           || (token[0] == '-' && token.size() > 1))) {
+    return false;
+  }
+  const std::string str(token);
+  char* end;
+  number = strtod(str.c_str(), &end);
+  return *end == '\0' && number >= INT_MIN && number <= INT_MAX;
+}
+
+bool parseInt(std::string_view token, int& value)
+{
+  double number;
+  if (!parseNumber(token, number)) {
+    return false;
+  }
+  // Same rounding the Si2 parser applies to NUMBER tokens.
+  value = static_cast<int>(number >= 0 ? number + 0.5 : number - 0.5);
+  return true;
+}
+
+// For the values Si2 truncates rather than rounds (masks, VIA DO, RECT).
+bool parseTruncated(std::string_view token, int& value)
+{
+  double number;
+  if (!parseNumber(token, number)) {
+    return false;
+  }
+  value = static_cast<int>(number);
+  return true;
+}
+
+bool parseOrient(std::string_view token, int& orient)
+{
+  static const std::pair<std::string_view, int> orients[]
+      = {{"N", DEF_ORIENT_N},
+         {"W", DEF_ORIENT_W},
+         {"S", DEF_ORIENT_S},
+         {"E", DEF_ORIENT_E},
+         {"FN", DEF_ORIENT_FN},
+         {"FW", DEF_ORIENT_FW},
+         {"FS", DEF_ORIENT_FS},
+         {"FE", DEF_ORIENT_FE}};
+  for (const auto& [name, value] : orients) {
+    if (token == name) {
+      orient = value;
+      return true;
+    }
+  }
+  return false;
+}
+
+// Keywords after a '+' are matched case insensitively by Si2.
+bool isKeyword(std::string_view token, std::string_view keyword)
+{
+  return token.size() == keyword.size()
+         && std::equal(token.begin(),
+                       token.end(),
+                       keyword.begin(),
+                       [](char a, char b) { return toupper(a) == b; });
+}
+
+// Returns the spelling Si2 passes on for a keyword from the list.
+std::string_view findKeyword(std::string_view token,
+                             std::initializer_list<std::string_view> keywords)
+{
+  for (std::string_view keyword : keywords) {
+    if (isKeyword(token, keyword)) {
+      return keyword;
+    }
+  }
+  return {};
+}
+
+// Inside routing the Si2 lexer only knows the upper and lower case forms
+// of NEW, MASK, RECT...  Other spellings are names, which is too subtle
+// to mirror, so they make the chunk fail.
+bool isRoutingKeyword(std::string_view token,
+                      std::string_view keyword,
+                      bool& ok)
+{
+  if (!isKeyword(token, keyword)) {
+    return false;
+  }
+  if (token == keyword
+      || std::all_of(token.begin(), token.end(), [](char c) {
+           return islower(static_cast<unsigned char>(c));
+         })) {
+    return true;
+  }
+  ok = false;
+  return false;
+}
+
+// Orientations are matched case insensitively, except for FE.
+bool isRoutingOrient(std::string_view token, int& orient, bool& ok)
+{
+  if (token.size() > 2) {
+    return false;
+  }
+  std::string upper(token);
+  std::transform(upper.begin(), upper.end(), upper.begin(), toupper);
+  if (!parseOrient(upper, orient)) {
+    return false;
+  }
+  if (token != upper) {
+    ok = false;
+    return false;
+  }
+  return true;
+}
+
+// A via name in routing: anything Si2 reads as a T_STRING.
+bool isViaName(std::string_view token, bool& ok)
+{
+  double number;
+  int orient;
+  if (token.empty() || token == "(" || token == ")" || token == "*"
+      || token == "+" || token == ";" || parseNumber(token, number)
+      || isRoutingOrient(token, orient, ok)) {
+    return false;
+  }
+  for (std::string_view keyword :
+       {"NEW", "MASK", "RECT", "VIRTUAL", "DO", "BY", "STEP", "TAPER"}) {
+    if (isKeyword(token, keyword)) {
+      return false;
+    }
+  }
+  return ok;
+}
+
+// Parses the rest of a routing point after its '('.
+bool parsePoint(Tokenizer& tokens, definScanner::PathItem& item)
+{
+  const std::string_view x = tokens.next();
+  const std::string_view y = tokens.next();
+  item.type = definScanner::POINT;
+  item.star_x = x == "*";
+  item.star_y = y == "*";
+  if ((!item.star_x && !parseInt(x, item.values[0]))
+      || (!item.star_y && !parseInt(y, item.values[1]))) {
+    return false;
+  }
+  const std::string_view token = tokens.next();
+  if (token == ")") {
+    return true;
+  }
+  item.type = definScanner::FLUSHPOINT;
+  return parseInt(token, item.values[2]) && tokens.next() == ")";
+}
+
+bool parseRect(Tokenizer& tokens, definScanner::PathItem& item)
+{
+  item.type = definScanner::RECT;
+  if (tokens.next() != "(") {
+    return false;
+  }
+  for (int& value : item.values) {
+    if (!parseTruncated(tokens.next(), value)) {
+      return false;
+    }
+  }
+  return tokens.next() == ")";
+}
+
+// Parses the paths of a wire up to the '+' or ';' that ends it, which is
+// returned in token.
+bool parseWire(Tokenizer& tokens,
+               bool special,
+               definScanner::Wire& wire,
+               std::string_view& token)
+{
+  using Item = definScanner::PathItem;
+  bool ok = true;
+  while (true) {
+    std::vector<Item> path;
+    const std::string_view layer = tokens.next();
+    if (!isViaName(layer, ok)) {
+      return false;
+    }
+    path.push_back({definScanner::LAYER, layer});
+
+    token = tokens.next();
+    if (special) {
+      Item width{definScanner::WIDTH};
+      if (!parseInt(token, width.values[0])) {
+        return false;
+      }
+      path.push_back(width);
+      token = tokens.next();
+      while (token == "+") {
+        if (!isKeyword(tokens.next(), "SHAPE")) {
+          return false;  // STYLE
+        }
+        const std::string_view shape = findKeyword(tokens.next(),
+                                                   {"RING",
+                                                    "STRIPE",
+                                                    "FOLLOWPIN",
+                                                    "IOWIRE",
+                                                    "COREWIRE",
+                                                    "BLOCKWIRE",
+                                                    "FILLWIRE",
+                                                    "FILLWIREOPC",
+                                                    "DRCFILL",
+                                                    "BLOCKAGEWIRE",
+                                                    "PADRING",
+                                                    "BLOCKRING"});
+        if (shape.empty()) {
+          return false;
+        }
+        path.push_back({definScanner::SHAPE, shape});
+        token = tokens.next();
+      }
+    } else if (token != "(") {
+      // netCallback only looks for one taper right after the layer.
+      if (isKeyword(token, "TAPER")) {
+        path.push_back({definScanner::TAPER});
+      } else if (isKeyword(token, "TAPERRULE")) {
+        const std::string_view rule = tokens.next();
+        if (!isViaName(rule, ok)) {
+          return false;
+        }
+        path.push_back({definScanner::TAPERRULE, rule});
+      } else {
+        return false;  // STYLE
+      }
+      token = tokens.next();
+    }
+
+    if (token != "(") {
+      return false;
+    }
+    Item point;
+    if (!parsePoint(tokens, point)) {
+      return false;
+    }
+    path.push_back(point);
+
+    token = tokens.next();
+    while (token != "+" && token != ";"
+           && !isRoutingKeyword(token, "NEW", ok)) {
+      if (token == "(") {
+        if (!parsePoint(tokens, point)) {
+          return false;
+        }
+        path.push_back(point);
+        token = tokens.next();
+        continue;
+      }
+      if (isRoutingKeyword(token, "RECT", ok)) {
+        Item rect;
+        if (special || !parseRect(tokens, rect)) {
+          return false;
+        }
+        path.push_back(rect);
+        token = tokens.next();
+        continue;
+      }
+
+      std::string_view via = token;
+      if (isRoutingKeyword(token, "MASK", ok)) {
+        int mask;
+        if (!parseTruncated(tokens.next(), mask)) {
+          return false;
+        }
+        token = tokens.next();
+        if (token == "(") {
+          path.push_back({definScanner::MASK, {}, {mask}});
+          if (!parsePoint(tokens, point)) {
+            return false;
+          }
+          path.push_back(point);
+          token = tokens.next();
+          continue;
+        }
+        if (isRoutingKeyword(token, "RECT", ok)) {
+          // A masked RECT is unsupported in special nets.
+          Item rect;
+          if (special || !parseRect(tokens, rect)) {
+            return false;
+          }
+          path.push_back({definScanner::MASK, {}, {mask}});
+          path.push_back(rect);
+          token = tokens.next();
+          continue;
+        }
+        path.push_back({definScanner::VIAMASK, {}, {mask}});
+        via = token;
+      }
+
+      // VIRTUAL and anything unexpected ends up here.
+      if (!isViaName(via, ok)) {
+        return false;
+      }
+      path.push_back({definScanner::VIA, via});
+      token = tokens.next();
+      int orient;
+      if (isRoutingOrient(token, orient, ok)) {
+        // Rotated vias are unsupported in special nets.
+        if (special) {
+          return false;
+        }
+        path.push_back({definScanner::VIAROTATION, {}, {orient}});
+        token = tokens.next();
+      }
+      if (isRoutingKeyword(token, "DO", ok)) {
+        // Via arrays are only valid in special nets.
+        Item data{definScanner::VIADATA};
+        if (!special || path.back().type != definScanner::VIA
+            || !parseTruncated(tokens.next(), data.values[0])
+            || !isRoutingKeyword(tokens.next(), "BY", ok)
+            || !parseTruncated(tokens.next(), data.values[1])
+            || !isRoutingKeyword(tokens.next(), "STEP", ok)
+            || !parseTruncated(tokens.next(), data.values[2])
+            || !parseTruncated(tokens.next(), data.values[3])
+            || data.values[0] == 0 || data.values[1] == 0) {
+          return false;
+        }
+        path.push_back(data);
+        token = tokens.next();
+      }
+    }
+    if (!ok) {
+      return false;
+    }
+    wire.paths.push_back(std::move(path));
+    if (token == "+" || token == ";") {
+      return true;
+    }
+  }
+}
+
+// Returns the position just after the line whose tokens are `first second`,
+// starting the search at pos.  The match position is returned in line_begin.
+const char* findLine(const char* pos,
+                     const char* end,
+                     std::string_view first,
+                     std::string_view second,
+                     const char*& line_begin)
+{
+  while (pos < end) {
+    const char* eol = static_cast<const char*>(memchr(pos, '\n', end - pos));
+    if (eol == nullptr) {
+      eol = end;
+    }
+    Tokenizer tokens(pos, eol);
+    if (tokens.next() == first && (second.empty() || tokens.next() == second)) {
+      line_begin = pos;
+      return eol == end ? end : eol + 1;
+    }
+    pos = eol + 1;
+  }
+  return nullptr;
+}
+
+// Whether [begin, end) has a '*' coordinate, which Si2 resolves against
+// the last point it read.
+bool hasStarPoint(const char* begin, const char* end)
+{
+  const char* pos = begin;
+  while ((pos = static_cast<const char*>(memchr(pos, '*', end - pos)))
+         != nullptr) {
+    const char* next = pos + 1;
+    if ((pos == begin || isSpace(pos[-1])) && (next == end || isSpace(*next))) {
+      // "( * pin )" connections are followed by a name.
+      Tokenizer tokens(next, end);
+      const std::string_view token = tokens.next();
+      double number;
+      if (token == ")" || token == "*" || parseNumber(token, number)) {
+        return true;
+      }
+    }
+    pos = next;
+  }
+  return false;
+}
+
+}  // namespace
+
+definScanner::~definScanner()
+{
+  unmap();
+}
+
+void definScanner::unmap()
+{
+  if (data_ != nullptr) {
+    munmap(const_cast<char*>(data_), size_);
+    data_ = nullptr;
+    size_ = 0;
+  }
+}
+
+bool definScanner::scan(const char* file, int num_threads)
+{
+  unmap();
+  components_.clear();
+  nets_.clear();
+  snets_.clear();
+  segments_.clear();
+  read_segment_ = 0;
+  read_offset_ = 0;
+
+  const int fd = open(file, O_RDONLY);
+  if (fd < 0) {
+    return false;
+  }
+  struct stat st;
+  if (fstat(fd, &st) != 0 || st.st_size == 0) {
+    close(fd);
+    return false;
+  }
+  size_ = st.st_size;
+  void* data = mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd);
+  if (data == MAP_FAILED) {
+    size_ = 0;
+    return false;
+  }
+  data_ = static_cast<const char*>(data);
+
+  const char* line;
+  const char* eol = findLine(data_, data_ + size_, "VERSION", "", line);
+  version_ = 0;
+  if (eol != nullptr) {
+    Tokenizer tokens(line, eol);
+    tokens.next();
+    const std::string version(tokens.next());
+    version_ = atof(version.c_str());
+  }
+
+  std::vector<Body> bodies;
+  Body body;
+  if (findSection("COMPONENTS", body) && scanComponents(body, num_threads)) {
+    bodies.push_back(body);
+  }
+  // Older versions get version dependent warnings and errors for parts
+  // of the routing syntax, which are left to Si2.
+  if (version_ >= 5.8) {
+    if (findSection("SPECIALNETS", body)
+        && scanNets(body, true, num_threads, snets_)) {
+      bodies.push_back(body);
+    }
+    if (findSection("NETS", body)
+        && scanNets(body, false, num_threads, nets_)) {
+      bodies.push_back(body);
+    }
+  }
+  std::sort(bodies.begin(), bodies.end(), [](const Body& a, const Body& b) {
+    return a.begin < b.begin;
+  });
+
+  // Si2 no longer sees the points in the scanned sections, so a '*'
+  // coordinate after them would resolve differently; read the sections up
+  // to such a point with Si2 after all.
+  for (size_t i = bodies.size(); i-- > 0;) {
+    const size_t end = i + 1 < bodies.size() ? bodies[i + 1].begin : size_;
+    if (hasStarPoint(data_ + bodies[i].end, data_ + end)) {
+      for (size_t j = 0; j <= i; ++j) {
+        if (bodies[j].keyword == "COMPONENTS") {
+          clearComponents();
+        } else if (bodies[j].keyword == "SPECIALNETS") {
+          clearSpecialNets();
+        } else {
+          clearNets();
+        }
+      }
+      bodies.erase(bodies.begin(), bodies.begin() + i + 1);
+      break;
+    }
+  }
+  if (bodies.empty()) {
+    unmap();
+    return false;
+  }
+
+  size_t pos = 0;
+  for (const Body& body : bodies) {
+    segments_.push_back({pos, body.begin - pos, false});
+    segments_.push_back({0, body.lines, true});
+    pos = body.end;
+  }
+  segments_.push_back({pos, size_ - pos, false});
+  return true;
+}
+
+bool definScanner::findSection(std::string_view keyword, Body& body) const
+{
+  const char* begin = data_;
+  const char* end = data_ + size_;
+
+  const char* header;
+  const char* body_begin = findLine(begin, end, keyword, "", header);
+  if (body_begin == nullptr) {
+    return false;
+  }
+  // The header must be a complete "<keyword> n ;" line.
+  Tokenizer tokens(header, body_begin);
+  int count;
+  tokens.next();
+  if (!parseInt(tokens.next(), count) || tokens.next() != ";"
+      || !tokens.atEnd()) {
+    return false;
+  }
+
+  const char* footer;
+  if (findLine(body_begin, end, "END", keyword, footer) == nullptr) {
+    return false;
+  }
+
+  body.keyword = keyword;
+  body.begin = body_begin - data_;
+  body.end = footer - data_;
+  body.lines = std::count(body_begin, footer, '\n');
+  return true;
+}
+
+// Splits a section at statement starts ("- " at the start of a line).
+std::vector<const char*> definScanner::splitSection(const Body& body,
+                                                    int num_threads) const
+{
+  const char* begin = data_ + body.begin;
+  const char* end = data_ + body.end;
+  const size_t num_chunks = std::clamp<size_t>(
+      (end - begin) / min_chunk_size, 1, std::max(num_threads, 1) * 4);
+  std::vector<const char*> bounds{begin};
+  for (size_t i = 1; i < num_chunks; ++i) {
+    const char* pos = std::max(begin + (end - begin) * i / num_chunks,
+                               bounds.back());
+    while (pos < end) {
+      pos = static_cast<const char*>(memchr(pos, '\n', end - pos));
+      if (pos == nullptr) {
+        pos = end;
+        break;
+      }
+      ++pos;
+      const char* start = pos;
+      while (start < end && (*start == ' ' || *start == '\t')) {
+        ++start;
+      }
+      if (start + 1 < end && *start == '-' && isSpace(start[1])) {
+        pos = start;
+        break;
+      }
+    }
+    bounds.push_back(pos);
+  }
+  bounds.push_back(end);
+  return bounds;
+}
+
+bool definScanner::scanComponents(const Body& body, int num_threads)
+{
+  const std::vector<const char*> bounds = splitSection(body, num_threads);
+  const size_t num_chunks = bounds.size() - 1;
+  std::vector<std::vector<Component>> chunks(num_chunks);
+  std::vector<char> ok(num_chunks, false);
+#pragma omp parallel for num_threads(num_threads) schedule(dynamic)
+  for (size_t i = 0; i < num_chunks; ++i) {
+    ok[i] = parseComponents(bounds[i], bounds[i + 1], chunks[i]);
+  }
+
+  if (std::find(ok.begin(), ok.end(), false) != ok.end()) {
+    return false;
+  }
+
+  size_t count = 0;
+  for (const auto& chunk : chunks) {
+    count += chunk.size();
+  }
+  components_.reserve(count);
+  for (auto& chunk : chunks) {
+    std::move(chunk.begin(), chunk.end(), std::back_inserter(components_));
+  }
+  return true;
+}
+
+bool definScanner::scanNets(const Body& body,
+                            bool special,
+                            int num_threads,
+                            std::vector<Net>& nets)
+{
+  const std::vector<const char*> bounds = splitSection(body, num_threads);
+  const size_t num_chunks = bounds.size() - 1;
+  std::vector<std::vector<Net>> chunks(num_chunks);
+  std::vector<char> ok(num_chunks, false);
+#pragma omp parallel for num_threads(num_threads) schedule(dynamic)
+  for (size_t i = 0; i < num_chunks; ++i) {
+    ok[i] = parseNets(bounds[i], bounds[i + 1], special, chunks[i]);
+  }
+
+  if (std::find(ok.begin(), ok.end(), false) != ok.end()) {
+    return false;
+  }
+
+  size_t count = 0;
+  for (const auto& chunk : chunks) {
+    count += chunk.size();
+  }
+  nets.reserve(count);
+  for (auto& chunk : chunks) {
+    std::move(chunk.begin(), chunk.end(), std::back_inserter(nets));
+  }
+
+  // Resolve the '*' coordinates in file order, as Si2 does.  One before
+  // any explicit value refers to a point before the section.
+  bool have_x = false;
+  bool have_y = false;
+  int save_x = 0;
+  int save_y = 0;
+  for (Net& net : nets) {
+    for (Wire& wire : net.wires) {
+      for (auto& path : wire.paths) {
+        for (PathItem& item : path) {
+          if (item.type != POINT && item.type != FLUSHPOINT) {
+            continue;
+          }
+          if (item.star_x) {
+            if (!have_x) {
+              nets.clear();
+              return false;
+            }
+            item.values[0] = save_x;
+            item.star_x = false;
+          } else {
+            save_x = item.values[0];
+            have_x = true;
+          }
+          if (item.star_y) {
+            if (!have_y) {
+              nets.clear();
+              return false;
+            }
+            item.values[1] = save_y;
+            item.star_y = false;
+          } else {
+            save_y = item.values[1];
+            have_y = true;
+          }
+        }
+      }
+    }
+  }
+  return true;
+}
+
+bool definScanner::parseComponents(const char* begin,
+                                   const char* end,
+                                   std::vector<Component>& components) const
+{
+  Tokenizer tokens(begin, end);
+  while (!tokens.atEnd()) {
+    if (tokens.next() != "-") {
+      return false;
+    }
+    Component comp;
+    comp.name = tokens.next();
+    comp.cell = tokens.next();
+    if (comp.name.empty() || comp.cell.empty()) {
+      return false;
+    }
+
+    while (true) {
+      const std::string_view token = tokens.next();
+      if (token == ";") {
+        break;
+      }
+      if (token != "+") {
+        return false;
+      }
+      const std::string_view keyword = tokens.next();
+      if (keyword == "PLACED" || keyword == "FIXED" || keyword == "COVER") {
+        if (keyword == "PLACED") {
+          comp.status = DEFI_COMPONENT_PLACED;
+        } else if (keyword == "FIXED") {
+          comp.status = DEFI_COMPONENT_FIXED;
+        } else {
+          comp.status = DEFI_COMPONENT_COVER;
+        }
+        if (tokens.next() != "(" || !parseInt(tokens.next(), comp.x)
+            || !parseInt(tokens.next(), comp.y) || tokens.next() != ")"
+            || !parseOrient(tokens.next(), comp.orient)) {
+          return false;
+        }
+      } else if (keyword == "UNPLACED") {
+        if (tokens.peek() == "(") {
+          // Pre 5.4 syntax; leave it to Si2.
+          return false;
+        }
+        comp.status = DEFI_COMPONENT_UNPLACED;
+        comp.x = -1;
+        comp.y = -1;
+        comp.orient = -1;
+      } else if (keyword == "SOURCE") {
+        comp.source = tokens.next();
+      } else if (keyword == "WEIGHT") {
+        comp.has_weight = true;
+        if (!parseInt(tokens.next(), comp.weight)) {
+          return false;
+        }
+      } else if (keyword == "REGION") {
+        comp.region = tokens.next();
+        if (comp.region.empty() || comp.region == "(") {
+          return false;
+        }
+      } else if (keyword == "HALO") {
+        if (tokens.peek() == "SOFT") {
+          tokens.next();
+        }
+        comp.has_halo = true;
+        for (int& edge : comp.halo) {
+          if (!parseInt(tokens.next(), edge)) {
+            return false;
+          }
+        }
+      } else {
+        // EEQMASTER, GENERATE, FOREIGN, MASKSHIFT, ROUTEHALO, PROPERTY...
+        return false;
+      }
+    }
+    components.push_back(std::move(comp));
+  }
+  return tokens.ok();
+}
+
+bool definScanner::parseNets(const char* begin,
+                             const char* end,
+                             bool special,
+                             std::vector<Net>& nets) const
+{
+  Tokenizer tokens(begin, end);
+  bool ok = true;
+  while (!tokens.atEnd()) {
+    if (tokens.next() != "-") {
+      return false;
+    }
+    Net net;
+    net.name = tokens.next();
+    if (net.name.empty() || isKeyword(net.name, "MUSTJOIN")) {
+      return false;
+    }
+
+    std::string_view token = tokens.next();
+    while (token == "(") {
+      Connection conn;
+      conn.inst = tokens.next();
+      conn.pin = tokens.next();
+      for (std::string_view name : {conn.inst, conn.pin}) {
+        if (name.empty() || name == ")" || name == "+" || name == ";"
+            || isKeyword(name, "MUSTJOIN")
+            || isKeyword(name, "NONDEFAULTRULE")) {
+          return false;
+        }
+      }
+      token = tokens.next();
+      if (token == "+") {
+        // SYNTHESIZED is unsupported on regular nets.
+        if (!special || !isKeyword(tokens.next(), "SYNTHESIZED")) {
+          return false;
+        }
+        conn.synthesized = true;
+        token = tokens.next();
+      }
+      if (token != ")") {
+        return false;
+      }
+      net.connections.push_back(conn);
+      token = tokens.next();
+    }
+
+    while (token != ";") {
+      if (token != "+") {
+        return false;
+      }
+      const std::string_view keyword = tokens.next();
+      const std::string_view wire_type
+          = findKeyword(keyword, {"FIXED", "COVER", "ROUTED"});
+      if (!wire_type.empty()) {
+        Wire wire;
+        wire.type = wire_type;
+        if (!parseWire(tokens, special, wire, token)) {
+          return false;
+        }
+        net.wires.push_back(std::move(wire));
+        continue;
+      }
+      if (isKeyword(keyword, "USE")) {
+        net.use = findKeyword(tokens.next(),
+                              {"SIGNAL",
+                               "POWER",
+                               "GROUND",
+                               "CLOCK",
+                               "TIEOFF",
+                               "ANALOG",
+                               "SCAN",
+                               "RESET"});
+        if (net.use.empty()) {
+          return false;
+        }
+      } else if (isKeyword(keyword, "SOURCE")) {
+        const std::string_view source = tokens.next();
+        net.source
+            = special
+                  ? findKeyword(source, {"NETLIST", "DIST", "USER", "TIMING"})
+                  : findKeyword(source,
+                                {"NETLIST", "DIST", "USER", "TIMING", "TEST"});
+        if (net.source.empty()) {
+          return false;
+        }
+      } else if (isKeyword(keyword, "FIXEDBUMP")) {
+        net.fixedbump = true;
+      } else if (isKeyword(keyword, "WEIGHT")) {
+        net.has_weight = true;
+        if (!parseInt(tokens.next(), net.weight)) {
+          return false;
+        }
+      } else if (!special && isKeyword(keyword, "NONDEFAULTRULE")) {
+        net.non_default_rule = tokens.next();
+        if (!isViaName(net.non_default_rule, ok)) {
+          return false;
+        }
+      } else {
+        // PROPERTY, SHIELDNET, NOSHIELD, VPIN, SUBNET, XTALK, FREQUENCY,
+        // ORIGINAL, PATTERN, ESTCAP, STYLE, SHIELD, RECT, POLYGON, VIA,
+        // VOLTAGE, WIDTH, SPACING, or a bare special net SHAPE or MASK...
+        return false;
+      }
+      token = tokens.next();
+    }
+    nets.push_back(std::move(net));
+  }
+  return ok && tokens.ok();
+}
+
+size_t definScanner::read(FILE* file, char* buffer, size_t size)
+{
+  auto scanner = reinterpret_cast<definScanner*>(file);
+
+  size_t count = 0;
+  while (count < size && scanner->read_segment_ < scanner->segments_.size()) {
+    const Segment& segment = scanner->segments_[scanner->read_segment_];
+    const size_t n
+        = std::min(size - count, segment.size - scanner->read_offset_);
+    if (segment.newlines) {
+      memset(buffer + count, '\n', n);
+    } else {
+      memcpy(buffer + count,
+             scanner->data_ + segment.offset + scanner->read_offset_,
+             n);
+    }
+    count += n;
+    scanner->read_offset_ += n;
+    if (scanner->read_offset_ == segment.size) {
+      ++scanner->read_segment_;
+      scanner->read_offset_ = 0;
+    }
+  }
+  return count;
+}
+
+}  // namespace odb
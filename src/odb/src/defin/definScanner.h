@@ -0,0 +1,192 @@
+///////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2024, The Regents of the University of California
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#pragma once
+
+#include <cstdio>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace odb {
+
+//
+// Pre-scans a DEF file for its COMPONENTS, SPECIALNETS and NETS sections
+// and tokenizes their statements in parallel chunks, so the Si2 parser
+// only has to read the rest of the file.  Only the statement forms
+// written by OpenROAD and most tools are handled; a section using
+// anything else is not scanned and is read by Si2 as usual.
+//
+class definScanner
+{
+ public:
+  struct Component
+  {
+    std::string name;
+    std::string cell;
+    int status = 0;  // DEFI_COMPONENT_*, 0 if unset
+    int x = 0;
+    int y = 0;
+    int orient = 0;  // DEF_ORIENT_*
+    std::string source;
+    std::string region;
+    bool has_weight = false;
+    int weight = 0;
+    bool has_halo = false;
+    int halo[4] = {0, 0, 0, 0};  // left, bottom, right, top
+  };
+
+  // Routing items in the order the Si2 defiPath would list them.
+  enum PathItemType
+  {
+    LAYER,         // name
+    TAPER,         // follows LAYER
+    TAPERRULE,     // name is the rule, follows LAYER
+    WIDTH,         // values[0], follows LAYER in special nets
+    SHAPE,         // name
+    VIA,           // name
+    VIAROTATION,   // values[0] is DEF_ORIENT_*, follows VIA
+    VIADATA,       // values are numX numY stepX stepY, follows VIA
+    VIAMASK,       // values[0] is the bottom, cut and top mask digits
+    MASK,          // values[0]
+    POINT,         // values[0..1]
+    FLUSHPOINT,    // values[0..2]
+    RECT           // values[0..3]
+  };
+
+  struct PathItem
+  {
+    PathItemType type;
+    std::string_view name;
+    int values[4] = {0, 0, 0, 0};
+    // Set while a '*' coordinate waits to be resolved by scan().
+    bool star_x = false;
+    bool star_y = false;
+  };
+
+  struct Wire
+  {
+    std::string_view type;  // FIXED, COVER or ROUTED
+    std::vector<std::vector<PathItem>> paths;
+  };
+
+  struct Connection
+  {
+    std::string_view inst;  // "*" or "PIN" for the special forms
+    std::string_view pin;
+    bool synthesized = false;
+  };
+
+  // A NETS or SPECIALNETS statement.  The names point into the mapped
+  // file, which stays valid until the scanner is destroyed.
+  struct Net
+  {
+    std::string_view name;
+    std::vector<Connection> connections;
+    std::string_view use;
+    std::string_view source;
+    std::string_view non_default_rule;
+    bool fixedbump = false;
+    bool has_weight = false;
+    int weight = 0;
+    std::vector<Wire> wires;
+  };
+
+  definScanner() = default;
+  ~definScanner();
+
+  // Map the file and tokenize its sections using num_threads threads.
+  // Returns false if no section could be handled.
+  bool scan(const char* file, int num_threads);
+
+  const std::vector<Component>& getComponents() const { return components_; }
+  void clearComponents() { std::vector<Component>().swap(components_); }
+  const std::vector<Net>& getNets() const { return nets_; }
+  void clearNets() { std::vector<Net>().swap(nets_); }
+  const std::vector<Net>& getSpecialNets() const { return snets_; }
+  void clearSpecialNets() { std::vector<Net>().swap(snets_); }
+
+  // Si2 read function (see defrSetReadFunction) serving the scanned file
+  // with the scanned statements replaced by their newlines, so the line
+  // numbers in parser messages are unchanged.  Like defGZip_read, the
+  // FILE* handed to defrRead is the scanner itself (see getFile).
+  static size_t read(FILE* file, char* buffer, size_t size);
+  FILE* getFile() { return reinterpret_cast<FILE*>(this); }
+
+ private:
+  // The statements of a section, [begin, end) in the file.
+  struct Body
+  {
+    std::string_view keyword;
+    size_t begin = 0;
+    size_t end = 0;
+    size_t lines = 0;
+  };
+
+  bool findSection(std::string_view keyword, Body& body) const;
+  std::vector<const char*> splitSection(const Body& body,
+                                        int num_threads) const;
+  bool scanComponents(const Body& body, int num_threads);
+  bool scanNets(const Body& body,
+                bool special,
+                int num_threads,
+                std::vector<Net>& nets);
+  bool parseComponents(const char* begin,
+                       const char* end,
+                       std::vector<Component>& components) const;
+  bool parseNets(const char* begin,
+                 const char* end,
+                 bool special,
+                 std::vector<Net>& nets) const;
+  void unmap();
+
+  // A piece of the stream served by read(): either file bytes or, for a
+  // scanned section, just its newlines.
+  struct Segment
+  {
+    size_t offset = 0;
+    size_t size = 0;
+    bool newlines = false;
+  };
+
+  const char* data_ = nullptr;
+  size_t size_ = 0;
+  double version_ = 0;
+  std::vector<Segment> segments_;
+  size_t read_segment_ = 0;
+  size_t read_offset_ = 0;
+  std::vector<Component> components_;
+  std::vector<Net> nets_;
+  std::vector<Net> snets_;
+};
+
+}  // namespace odb
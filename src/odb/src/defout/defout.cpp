@@ -75,6 +75,11 @@ void defout::setVersion(Version v)
   _writer->setVersion(v);
 }
 
+void defout::setThreadCount(int threads)
+{
+  _writer->setThreadCount(threads);
+}
+
 bool defout::writeBlock(dbBlock* block, const char* def_file)
 {
   return _writer->writeBlock(block, def_file);
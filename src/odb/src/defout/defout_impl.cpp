@@ -32,11 +32,17 @@
 
 #include "defout_impl.h"
 
+#include <omp.h>
 #include <stdio.h>
 #include <sys/stat.h>
+#include <unistd.h>
 
+#include <algorithm>
 #include <cstdint>
+#include <cstdlib>
+#include <cstring>
 #include <limits>
+#include <memory>
 #include <optional>
 #include <set>
 #include <string>
@@ -50,6 +56,55 @@ namespace odb {
 
 static const int max_name_length = 256;
 
+// Objects formatted by one thread into a single buffer, and the number of
+// such chunks formatted in parallel before they are written out.
+static const int objects_per_chunk = 512;
+static const int chunks_per_thread = 8;
+
+static bool isGzipped(const char* file)
+{
+  const size_t len = strlen(file);
+  return len > 3 && strcmp(file + len - 3, ".gz") == 0;
+}
+
+// Largest block handed to gzwrite, whose length is an unsigned int.
+static const size_t max_gz_write = 1 << 30;
+
+template <typename Spool>
+static bool openSpool(Spool& spool)
+{
+  spool.file = open_memstream(&spool.data, &spool.size);
+  return spool.file != nullptr;
+}
+
+template <typename Spool>
+static void closeSpool(Spool& spool)
+{
+  if (spool.file != nullptr) {
+    fclose(spool.file);
+    spool.file = nullptr;
+  }
+  free(spool.data);
+  spool.data = nullptr;
+  spool.size = 0;
+}
+
+// Pass what was written to a spool since it was last rewound to sink, then
+// rewind it so the buffer is reused from the start.  Returns false if the
+// spool could not hold the output.
+template <typename Spool, typename Sink>
+static bool drainSpool(Spool& spool, Sink sink)
+{
+  if (fflush(spool.file) != 0 || ferror(spool.file)) {
+    return false;
+  }
+  if (spool.size > 0) {
+    sink(spool.data, spool.size);
+  }
+  rewind(spool.file);
+  return true;
+}
+
 template <typename T>
 static std::vector<T*> sortedSet(dbSet<T>& to_sort)
 {
@@ -153,25 +208,46 @@ bool defout_impl::writeBlock(dbBlock* block, const char* def_file)
 
   _dist_factor
       = (double) block->getDefUnits() / (double) block->getDbUnitsPerMicron();
-  utl::FileHandler fileHandler(def_file);
-  _out = fileHandler.getFile();
+  // Both plain and compressed output go to a temporary file which is only
+  // renamed to def_file once it is closed.
+  utl::FileHandler fileHandler(def_file, isGzipped(def_file));
+  _write_error = false;
+  if (isGzipped(def_file)) {
+    // Compressed output is formatted into an in-memory spool which is
+    // deflated into the DEF every few thousand objects (see flushOutput).
+    const int fd = dup(fileno(fileHandler.getFile()));
+    _gz_out = fd >= 0 ? gzdopen(fd, "wb") : nullptr;
+    if (_gz_out == nullptr && fd >= 0) {
+      close(fd);
+    }
+    _out = _gz_out && openSpool(_gz_spool) ? _gz_spool.file : nullptr;
+  } else {
+    _out = fileHandler.getFile();
+  }
 
   if (_out == nullptr) {
     _logger->warn(
         utl::ODB, 172, "Cannot open DEF file ({}) for writing", def_file);
+    if (_gz_out) {
+      gzclose(_gz_out);
+      _gz_out = nullptr;
+    }
     return false;
   }
 
-  // By default C File*'s are line buffered which means they get dumped on every
-  // newline, which is nominally pretty expensive. This makes it so that the
-  // writes are buffered according to the block size which on modern systems can
-  // be as much as 16kb. DEF's have a lot of newlines, and are large in size
-  // which makes writing them really slow with line buffering.
-  //
-  // The following lines enable IO buffering based on disk block size.
-  struct stat stats;
-  fstat(fileno(_out), &stats);
-  setvbuf(_out, nullptr, _IOFBF, stats.st_blksize);
+  if (!_gz_out) {
+    // By default C File*'s are line buffered which means they get dumped on
+    // every newline, which is nominally pretty expensive. This makes it so
+    // that the writes are buffered according to the block size which on
+    // modern systems can be as much as 16kb. DEF's have a lot of newlines, and
+    // are large in size which makes writing them really slow with line
+    // buffering.
+    //
+    // The following lines enable IO buffering based on disk block size.
+    struct stat stats;
+    fstat(fileno(_out), &stats);
+    setvbuf(_out, nullptr, _IOFBF, stats.st_blksize);
+  }
 
   if (_version == defout::DEF_5_3) {
     fprintf(_out, "VERSION 5.3 ;\n");
@@ -243,15 +319,144 @@ bool defout_impl::writeBlock(dbBlock* block, const char* def_file)
   writeGroups(block);
 
   fprintf(_out, "END DESIGN\n");
+  if (_gz_out) {
+    flushOutput();
+    closeSpool(_gz_spool);
+    if (gzclose(_gz_out) != Z_OK) {
+      _write_error = true;
+    }
+    _gz_out = nullptr;
+  } else if (fflush(_out) != 0 || ferror(_out)) {
+    _write_error = true;
+  }
+  _out = nullptr;
   {
     delete _select_net_map;
   }
   {
     delete _select_inst_map;
   }
+  if (_write_error) {
+    _logger->warn(utl::ODB, 1105, "Error writing DEF file ({})", def_file);
+    return false;
+  }
   return true;
 }
 
+defout_impl::defout_impl(const defout_impl& parent, FILE* out)
+{
+  _dist_factor = parent._dist_factor;
+  _out = out;
+  _gz_out = nullptr;
+  _write_error = false;
+  _threads = 1;
+  _use_net_inst_ids = parent._use_net_inst_ids;
+  _use_master_ids = parent._use_master_ids;
+  _use_alias = parent._use_alias;
+  _select_net_map = parent._select_net_map;
+  _select_inst_map = parent._select_inst_map;
+  _non_default_rule = nullptr;
+  _version = parent._version;
+  _prop_defs = parent._prop_defs;
+  _logger = parent._logger;
+}
+
+template <typename T>
+void defout_impl::writeObjects(const std::vector<T*>& objects,
+                               void (defout_impl::*write_object)(T*))
+{
+  const int num_objects = objects.size();
+  if (_threads <= 1 || num_objects <= objects_per_chunk) {
+    for (int i = 0; i < num_objects; ++i) {
+      (this->*write_object)(objects[i]);
+      if ((i + 1) % (objects_per_chunk * chunks_per_thread) == 0) {
+        flushOutput();
+      }
+    }
+    return;
+  }
+
+  const int num_chunks
+      = (num_objects + objects_per_chunk - 1) / objects_per_chunk;
+  const int chunks_per_batch = std::min(_threads * chunks_per_thread,
+                                        num_chunks);
+  // Each chunk is formatted into its own spool, reused across batches.
+  std::vector<Spool> spools(chunks_per_batch);
+  for (Spool& spool : spools) {
+    if (!openSpool(spool)) {
+      for (Spool& opened : spools) {
+        closeSpool(opened);
+      }
+      for (T* object : objects) {
+        (this->*write_object)(object);
+      }
+      return;
+    }
+  }
+  // Each thread formats with its own writer so per object state such as
+  // _non_default_rule isn't shared.
+  std::vector<std::unique_ptr<defout_impl>> writers;
+  for (int i = 0; i < _threads; ++i) {
+    writers.emplace_back(new defout_impl(*this, nullptr));
+  }
+
+  flushOutput();
+  for (int batch = 0; batch < num_chunks; batch += chunks_per_batch) {
+    const int batch_chunks = std::min(chunks_per_batch, num_chunks - batch);
+#pragma omp parallel for num_threads(_threads) schedule(dynamic)
+    for (int i = 0; i < batch_chunks; ++i) {
+      defout_impl& writer = *writers[omp_get_thread_num()];
+      writer._out = spools[i].file;
+      const int begin = (batch + i) * objects_per_chunk;
+      const int end = std::min(begin + objects_per_chunk, num_objects);
+      for (int j = begin; j < end; ++j) {
+        (writer.*write_object)(objects[j]);
+      }
+    }
+
+    for (int i = 0; i < batch_chunks; ++i) {
+      if (!drainSpool(spools[i], [this](const char* data, size_t size) {
+            writeBuffer(data, size);
+          })) {
+        _write_error = true;
+      }
+    }
+  }
+
+  for (Spool& spool : spools) {
+    closeSpool(spool);
+  }
+}
+
+void defout_impl::writeBuffer(const char* data, size_t size)
+{
+  if (_gz_out) {
+    while (size > 0) {
+      const unsigned count = std::min(size, max_gz_write);
+      if (gzwrite(_gz_out, data, count) != (int) count) {
+        _write_error = true;
+        return;
+      }
+      data += count;
+      size -= count;
+    }
+  } else if (fwrite(data, 1, size, _out) != size) {
+    _write_error = true;
+  }
+}
+
+void defout_impl::flushOutput()
+{
+  if (!_gz_out) {
+    return;
+  }
+  if (!drainSpool(_gz_spool, [this](const char* data, size_t size) {
+        writeBuffer(data, size);
+      })) {
+    _write_error = true;
+  }
+}
+
 void defout_impl::writeRows(dbBlock* block)
 {
   dbSet<dbRow> rows = block->getRows();
@@ -516,12 +721,16 @@ void defout_impl::writeInsts(dbBlock* block)
   fprintf(_out, "COMPONENTS %u ;\n", insts.size());
 
   // Sort the components for consistent output
-  for (dbInst* inst : sortedSet(insts)) {
-    if (_select_inst_map && !(*_select_inst_map)[inst]) {
-      continue;
-    }
-    writeInst(inst);
+  std::vector<dbInst*> sorted_insts = sortedSet(insts);
+  if (_select_inst_map) {
+    auto unselected = [this](dbInst* inst) {
+      return !(*_select_inst_map)[inst];
+    };
+    auto last
+        = std::remove_if(sorted_insts.begin(), sorted_insts.end(), unselected);
+    sorted_insts.erase(last, sorted_insts.end());
   }
+  writeObjects(sorted_insts, &defout_impl::writeInst);
 
   fprintf(_out, "END COMPONENTS\n");
 }
@@ -1369,29 +1578,35 @@ void defout_impl::writeNets(dbBlock* block)
   if (snet_cnt > 0) {
     fprintf(_out, "SPECIALNETS %d ;\n", snet_cnt);
 
+    std::vector<dbNet*> snets;
+    snets.reserve(snet_cnt);
     for (dbNet* net : sorted_nets) {
       if (_select_net_map && !(*_select_net_map)[net]) {
         continue;
       }
       if (net->isSpecial()) {
-        writeSNet(net);
+        snets.push_back(net);
       }
     }
+    writeObjects(snets, &defout_impl::writeSNet);
 
     fprintf(_out, "END SPECIALNETS\n");
   }
 
   fprintf(_out, "NETS %d ;\n", net_cnt);
 
+  std::vector<dbNet*> regular_nets;
+  regular_nets.reserve(net_cnt);
   for (dbNet* net : sorted_nets) {
     if (_select_net_map && !(*_select_net_map)[net]) {
       continue;
     }
 
     if (regular_net[net] == 1) {
-      writeNet(net);
+      regular_nets.push_back(net);
     }
   }
+  writeObjects(regular_nets, &defout_impl::writeNet);
 
   fprintf(_out, "END NETS\n");
 }
@@ -2144,7 +2359,7 @@ void defout_impl::writePropertyDefinitions(dbBlock* block)
       continue;
     }
 
-    std::map<std::string, bool>& defs_map = _prop_defs[obj_type];
+    std::map<std::string, bool>& defs_map = (*_prop_defs)[obj_type];
     dbSet<dbProperty> props = dbProperty::getProperties(obj);
     dbSet<dbProperty>::iterator pitr;
 
@@ -2246,7 +2461,7 @@ bool defout_impl::hasProperties(dbObject* object, ObjType type)
     dbProperty* prop = *itr;
     std::string name = prop->getName();
 
-    if (_prop_defs[type].find(name) != _prop_defs[type].end()) {
+    if ((*_prop_defs)[type].find(name) != (*_prop_defs)[type].end()) {
       return true;
     }
   }
@@ -32,9 +32,14 @@
 
 #pragma once
 
+#include <zlib.h>
+
+#include <array>
 #include <list>
 #include <map>
+#include <memory>
 #include <string>
+#include <vector>
 
 #include "odb/db.h"
 #include "odb/dbMap.h"
@@ -67,8 +72,23 @@ class defout_impl
     SPECIALNET
   };
 
+  // An in-memory stream that output is formatted into before it is written
+  // to the DEF.
+  struct Spool
+  {
+    FILE* file = nullptr;
+    char* data = nullptr;
+    size_t size = 0;
+  };
+
+  using PropDefs = std::array<std::map<std::string, bool>, 9>;
+
   double _dist_factor;
   FILE* _out;
+  gzFile _gz_out;
+  Spool _gz_spool;
+  bool _write_error;
+  int _threads;
   bool _use_net_inst_ids;
   bool _use_master_ids;
   bool _use_alias;
@@ -78,7 +98,7 @@ class defout_impl
   dbMap<dbInst, char>* _select_inst_map;
   dbTechNonDefaultRule* _non_default_rule;
   int _version;
-  std::map<std::string, bool> _prop_defs[9];
+  std::shared_ptr<PropDefs> _prop_defs;
   utl::Logger* _logger;
 
   int defdist(int value) { return (int) (((double) value) * _dist_factor); }
@@ -115,11 +135,25 @@ class defout_impl
   void writePinProperties(dbBlock* block);
   bool hasProperties(dbObject* object, ObjType type);
 
+  // Write the objects in order, formatting chunks of them in parallel.
+  template <typename T>
+  void writeObjects(const std::vector<T*>& objects,
+                    void (defout_impl::*write_object)(T*));
+  void writeBuffer(const char* data, size_t size);
+  void flushOutput();
+
+  // A writer formatting into out for writeObjects. It shares the settings,
+  // selection and property definitions of parent.
+  defout_impl(const defout_impl& parent, FILE* out);
+
  public:
   defout_impl(utl::Logger* logger)
   {
     _dist_factor = 0;
     _out = nullptr;
+    _gz_out = nullptr;
+    _write_error = false;
+    _threads = 1;
     _use_net_inst_ids = false;
     _use_master_ids = false;
     _use_alias = false;
@@ -127,6 +161,7 @@ class defout_impl
     _select_inst_map = nullptr;
     _non_default_rule = nullptr;
     _version = defout::DEF_5_8;
+    _prop_defs = std::make_shared<PropDefs>();
     _logger = logger;
   }
 
@@ -142,6 +177,7 @@ class defout_impl
 
   void selectInst(dbInst* inst);
   void setVersion(int v) { _version = v; }
+  void setThreadCount(int threads) { _threads = threads; }
 
   bool writeBlock(dbBlock* block, const char* def_file);
 };
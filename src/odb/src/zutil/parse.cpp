@@ -32,6 +32,12 @@
 
 #include "odb/parse.h"
 
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
 #include <cstdio>
 #include <cstdlib>
 #include <cstring>
@@ -105,6 +111,7 @@ Ath__parser::~Ath__parser()
   if (_inFP) {
     ATH__closeFile(_inFP);
   }
+  unmapFile();
 }
 
 void Ath__parser::init()
@@ -121,6 +128,7 @@ void Ath__parser::init()
   _wordSeparators = ATH__allocCharWord(24, _logger);
 
   strcpy(_wordSeparators, " \n\t");
+  updateSeparators();
 
   _commentChar = '#';
 
@@ -153,11 +161,73 @@ bool Ath__parser::isDigit(int ii, int jj)
 void Ath__parser::resetSeparator(const char* s)
 {
   strcpy(_wordSeparators, s);
+  updateSeparators();
 }
 
 void Ath__parser::addSeparator(const char* s)
 {
   strcat(_wordSeparators, s);
+  updateSeparators();
+}
+
+void Ath__parser::updateSeparators()
+{
+  std::fill(_isSeparator, _isSeparator + 256, false);
+  for (const char* s = _wordSeparators; *s != '\0'; s++) {
+    _isSeparator[(unsigned char) *s] = true;
+  }
+}
+
+bool Ath__parser::mapFile(const char* name)
+{
+  unmapFile();
+
+  const int fd = open(name, O_RDONLY);
+  if (fd < 0) {
+    return false;
+  }
+  struct stat st;
+  if (fstat(fd, &st) != 0 || st.st_size == 0) {
+    close(fd);
+    return false;
+  }
+  void* data = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd);
+  if (data == MAP_FAILED) {
+    return false;
+  }
+  madvise(data, st.st_size, MADV_SEQUENTIAL);
+  _mapData = static_cast<const char*>(data);
+  _mapSize = st.st_size;
+  _mapPos = 0;
+  return true;
+}
+
+void Ath__parser::unmapFile()
+{
+  if (_mapData != nullptr) {
+    munmap(const_cast<char*>(_mapData), _mapSize);
+    _mapData = nullptr;
+    _mapSize = 0;
+    _mapPos = 0;
+  }
+}
+
+// Same as fgets on the mapped file: copy up to and including the next
+// newline, at most _lineSize - 1 chars.
+bool Ath__parser::readMappedLine()
+{
+  if (_mapPos >= _mapSize) {
+    return false;
+  }
+  const char* begin = _mapData + _mapPos;
+  const size_t avail = std::min(_mapSize - _mapPos, (size_t) _lineSize - 1);
+  const char* newline = static_cast<const char*>(memchr(begin, '\n', avail));
+  const size_t len = newline ? newline - begin + 1 : avail;
+  memcpy(_line, begin, len);
+  _line[len] = '\0';
+  _mapPos += len;
+  return true;
 }
 
 void Ath__parser::openFile(const char* name)
@@ -166,6 +236,7 @@ void Ath__parser::openFile(const char* name)
       && !strcmp(name + strlen(name) - 3, ".gz")) {
     char cmd[256];
     sprintf(cmd, "gzip -cd %s", name);
+    unmapFile();
     _inFP = popen(cmd, "r");
     strcpy(_inputFile, name);
   } else if (name == nullptr && strlen(_inputFile) > 4
@@ -184,8 +255,12 @@ void Ath__parser::openFile(const char* name)
     sprintf(cmd, "gzip -cd %s", _inputFile);
     _inFP = popen(cmd, "r");
   } else if (name != nullptr) {
-    _inFP = ATH__openFile(name, "r", _logger);
     strcpy(_inputFile, name);
+    if (!mapFile(name)) {
+      _inFP = ATH__openFile(name, "r", _logger);
+    }
+  } else if (_mapData != nullptr) {  // rewind
+    _mapPos = 0;
   } else {  //
     _inFP = ATH__openFile(_inputFile, "r", _logger);
   }
@@ -193,6 +268,7 @@ void Ath__parser::openFile(const char* name)
 
 void Ath__parser::setInputFP(FILE* fp)
 {
+  unmapFile();
   _inFP = fp;
 }
 
@@ -292,14 +368,14 @@ int Ath__parser::mkWords(const char* word, const char* sep)
   char buf1[100];
   if (sep != nullptr) {
     strcpy(buf1, _wordSeparators);
-    strcpy(_wordSeparators, sep);
+    resetSeparator(sep);
   }
 
   strcpy(_line, word);
   _currentWordCnt = mkWords(0);
 
   if (sep != nullptr) {
-    strcpy(_wordSeparators, buf1);
+    resetSeparator(buf1);
   }
 
   return _currentWordCnt;
@@ -330,13 +406,7 @@ int Ath__parser::mkDirTree(const char* word, const char* sep)
 
 bool Ath__parser::isSeparator(char a)
 {
-  int len = strlen(_wordSeparators);
-  for (int k = 0; k < len; k++) {
-    if (a == _wordSeparators[k]) {
-      return true;
-    }
-  }
-  return false;
+  return _isSeparator[(unsigned char) a];
 }
 
 int Ath__parser::mkWords(int jj)
@@ -390,7 +460,8 @@ void Ath__parser::reportProgress()
 
 int Ath__parser::readLineAndBreak(int prevWordCnt)
 {
-  if (fgets(_line, _lineSize, _inFP) == nullptr) {
+  if (_mapData != nullptr ? !readMappedLine()
+                          : fgets(_line, _lineSize, _inFP) == nullptr) {
     _currentWordCnt = prevWordCnt;
     return prevWordCnt;
   }
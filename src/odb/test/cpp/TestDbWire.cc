@@ -10,6 +10,7 @@
 
 #include "gtest/gtest.h"
 #include "odb/db.h"
+#include "odb/dbShape.h"
 #include "odb/dbWireCodec.h"
 #include "odb/lefin.h"
 #include "utl/Logger.h"
@@ -130,4 +131,50 @@ TEST_F(OdbMultiPatternedTest, WireColorIsClearedOnNewPath)
   EXPECT_EQ(decoder.getColor().value(), /*mask_color=*/2);
 }
 
+TEST_F(OdbMultiPatternedTest, ShapeIndexMatchesWire)
+{
+  // Arrange
+  dbNet* net = dbNet::create(block_.get(), "net0");
+  dbTech* tech = lib_->getTech();
+  dbTechLayer* met1 = tech->findLayer("met1");
+  dbTechLayer* met2 = tech->findLayer("met2");
+  dbTechVia* met1_met2 = tech->findVia("M1M2_PR_MR");
+  dbWire* wire = dbWire::create(net);
+
+  dbWireEncoder encoder;
+  encoder.begin(wire);
+  encoder.newPath(met1, dbWireType::ROUTED);
+  encoder.addPoint(50, 50);
+  int junction_1 = encoder.addPoint(100, 50);
+  encoder.addTechVia(met1_met2);
+  encoder.addPoint(100, 130);
+  encoder.newPath(junction_1, dbWireType::ROUTED);
+  encoder.addPoint(130, 50);
+  encoder.end();
+
+  // Act
+  dbWireShapeIndex index;
+  index.build(wire);
+
+  // Assert
+  int count = 0;
+  dbShape shape;
+  dbWireShapeItr shapes;
+  for (shapes.begin(wire); shapes.next(shape); ++count) {
+    dbShape indexed;
+    ASSERT_TRUE(index.getShape(shapes.getShapeId(), indexed));
+    EXPECT_EQ(indexed.getBox(), shape.getBox());
+    EXPECT_EQ(indexed.isVia(), shape.isVia());
+  }
+  EXPECT_EQ(count, 4);
+  EXPECT_EQ(index.getShapes().size(), count);
+  EXPECT_EQ(index.getLayerShapes(met1).size(), 3);
+  EXPECT_EQ(index.getLayerShapes(met2).size(), 2);
+
+  Point point;
+  ASSERT_TRUE(index.getCoord(junction_1, point));
+  EXPECT_EQ(point, Point(100, 50));
+  EXPECT_EQ(point, wire->getCoord(junction_1));
+}
+
 }  // namespace odb
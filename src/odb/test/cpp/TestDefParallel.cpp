@@ -0,0 +1,299 @@
+#define BOOST_TEST_MODULE TestDefParallel
+#include <zlib.h>
+
+#include <boost/test/included/unit_test.hpp>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "odb/db.h"
+#include "odb/defin.h"
+#include "odb/defout.h"
+#include "odb/lefin.h"
+#include "utl/Logger.h"
+
+namespace odb {
+namespace {
+
+constexpr const char* gcd_def = "data/gcd/gcd_nangate45_route.def";
+
+dbDatabase* readDesign(utl::Logger* logger,
+                       int threads,
+                       const char* def_file = gcd_def)
+{
+  dbDatabase* db = dbDatabase::create();
+  db->setLogger(logger);
+  lefin lef_reader(db, logger, false);
+  dbLib* lib = lef_reader.createTechAndLib(
+      "tech", "lib", "data/Nangate45/NangateOpenCellLibrary.mod.lef");
+
+  std::vector<dbLib*> libs{lib};
+  defin def_reader(db, logger);
+  def_reader.setThreadCount(threads);
+  def_reader.createChip(libs, def_file, lib->getTech());
+  return db;
+}
+
+// The block written back out as DEF, to compare whole designs.
+std::string writeDesign(utl::Logger* logger, dbBlock* block, const char* name)
+{
+  const std::string def_file = std::filesystem::temp_directory_path() / name;
+  defout writer(logger);
+  writer.writeBlock(block, def_file.c_str());
+  std::ifstream in(def_file);
+  std::stringstream buffer;
+  buffer << in.rdbuf();
+  std::filesystem::remove(def_file);
+  return buffer.str();
+}
+
+BOOST_AUTO_TEST_SUITE(test_suite)
+
+BOOST_AUTO_TEST_CASE(test_parallel_components)
+{
+  utl::Logger logger;
+  dbDatabase* serial_db = readDesign(&logger, 1);
+  dbDatabase* parallel_db = readDesign(&logger, 4);
+  dbBlock* serial = serial_db->getChip()->getBlock();
+  dbBlock* parallel = parallel_db->getChip()->getBlock();
+
+  BOOST_TEST(serial->getInsts().size() == 1877);
+  BOOST_TEST(parallel->getInsts().size() == serial->getInsts().size());
+  BOOST_TEST(parallel->getNets().size() == serial->getNets().size());
+
+  auto parallel_inst = parallel->getInsts().begin();
+  for (dbInst* inst : serial->getInsts()) {
+    BOOST_TEST(inst->getName() == (*parallel_inst)->getName());
+    BOOST_TEST(inst->getMaster()->getName()
+               == (*parallel_inst)->getMaster()->getName());
+    BOOST_TEST(inst->getLocation() == (*parallel_inst)->getLocation());
+    BOOST_TEST(inst->getOrient() == (*parallel_inst)->getOrient());
+    BOOST_TEST(inst->getPlacementStatus()
+               == (*parallel_inst)->getPlacementStatus());
+    ++parallel_inst;
+  }
+
+  dbDatabase::destroy(serial_db);
+  dbDatabase::destroy(parallel_db);
+}
+
+BOOST_AUTO_TEST_CASE(test_parallel_components_chunks)
+{
+  // The scanner splits COMPONENTS into 1MB chunks; write a section large
+  // enough to be split several ways and mix in the optional fields.
+  const std::string def_file = std::filesystem::temp_directory_path()
+                               / "TestDefParallel_chunks.def";
+  constexpr int num_insts = 100000;
+  const char* cells[] = {"INV_X1", "BUF_X2", "NAND2_X1", "DFF_X1"};
+  const char* orients[] = {"N", "FS", "S", "FN"};
+  {
+    std::ofstream out(def_file);
+    out << "VERSION 5.8 ;\nDIVIDERCHAR \"/\" ;\nBUSBITCHARS \"[]\" ;\n"
+        << "DESIGN chunks ;\nUNITS DISTANCE MICRONS 2000 ;\n"
+        << "DIEAREA ( 0 0 ) ( 2000000 2000000 ) ;\n"
+        << "COMPONENTS " << num_insts << " ;\n";
+    for (int i = 0; i < num_insts; ++i) {
+      out << "    - inst_" << i << " " << cells[i % 4];
+      if (i % 7 == 0) {
+        out << " + SOURCE TIMING";
+      }
+      if (i % 11 == 0) {
+        out << " + WEIGHT " << i % 5;
+      }
+      if (i % 13 == 0) {
+        out << " + UNPLACED ;\n";
+        continue;
+      }
+      out << "\n      + " << (i % 3 == 0 ? "FIXED" : "PLACED") << " ( "
+          << (i % 1000) * 380 << " " << (i / 1000) * 2800 << " ) "
+          << orients[i % 4] << " ;\n";
+    }
+    out << "END COMPONENTS\nEND DESIGN\n";
+  }
+  BOOST_TEST_REQUIRE(std::filesystem::file_size(def_file) > (4 << 20));
+
+  utl::Logger logger;
+  dbDatabase* serial_db = readDesign(&logger, 1, def_file.c_str());
+  dbDatabase* parallel_db = readDesign(&logger, 8, def_file.c_str());
+  dbBlock* serial = serial_db->getChip()->getBlock();
+  dbBlock* parallel = parallel_db->getChip()->getBlock();
+
+  BOOST_TEST(serial->getInsts().size() == num_insts);
+  BOOST_TEST(parallel->getInsts().size() == num_insts);
+
+  auto parallel_inst = parallel->getInsts().begin();
+  for (dbInst* inst : serial->getInsts()) {
+    dbInst* other = *parallel_inst++;
+    BOOST_TEST(inst->getName() == other->getName());
+    BOOST_TEST(inst->getMaster() != nullptr);
+    BOOST_TEST(inst->getMaster()->getName() == other->getMaster()->getName());
+    BOOST_TEST(inst->getLocation() == other->getLocation());
+    BOOST_TEST(inst->getOrient() == other->getOrient());
+    BOOST_TEST(inst->getPlacementStatus() == other->getPlacementStatus());
+    BOOST_TEST(inst->getSourceType() == other->getSourceType());
+    BOOST_TEST(inst->getWeight() == other->getWeight());
+  }
+
+  dbDatabase::destroy(serial_db);
+  dbDatabase::destroy(parallel_db);
+  std::filesystem::remove(def_file);
+}
+
+BOOST_AUTO_TEST_CASE(test_parallel_routing)
+{
+  // SPECIALNETS and NETS are scanned too; the routing must come out the
+  // same as from the serial read.
+  utl::Logger logger;
+  dbDatabase* serial_db = readDesign(&logger, 1);
+  dbDatabase* parallel_db = readDesign(&logger, 4);
+  dbBlock* serial = serial_db->getChip()->getBlock();
+  dbBlock* parallel = parallel_db->getChip()->getBlock();
+
+  BOOST_TEST(serial->getNets().size() == 441);
+  const std::string serial_def
+      = writeDesign(&logger, serial, "TestDefParallel_routing_serial.def");
+  BOOST_TEST(serial_def.find("+ ROUTED metal2 ( 42750 74060 ) ( * 95900 )")
+             != std::string::npos);
+  BOOST_TEST(serial_def
+             == writeDesign(
+                 &logger, parallel, "TestDefParallel_routing_parallel.def"));
+
+  dbDatabase::destroy(serial_db);
+  dbDatabase::destroy(parallel_db);
+}
+
+BOOST_AUTO_TEST_CASE(test_parallel_routing_chunks)
+{
+  // Enough routing to be split into several chunks, with '*' points that
+  // refer back across statements and chunks.
+  const std::string def_file = std::filesystem::temp_directory_path()
+                               / "TestDefParallel_routing_chunks.def";
+  constexpr int num_nets = 20000;
+  {
+    std::ofstream out(def_file);
+    out << "VERSION 5.8 ;\nDIVIDERCHAR \"/\" ;\nBUSBITCHARS \"[]\" ;\n"
+        << "DESIGN chunks ;\nUNITS DISTANCE MICRONS 2000 ;\n"
+        << "DIEAREA ( 0 0 ) ( 2000000 2000000 ) ;\n"
+        << "COMPONENTS " << num_nets + 1 << " ;\n";
+    for (int i = 0; i <= num_nets; ++i) {
+      out << "    - inst_" << i << " INV_X1 + PLACED ( " << (i % 1000) * 380
+          << " " << (i / 1000) * 2800 << " ) N ;\n";
+    }
+    out << "END COMPONENTS\n"
+        << "SPECIALNETS 2 ;\n"
+        << "    - VDD ( * VDD ) + USE POWER\n"
+        << "      + ROUTED metal1 170 + SHAPE FOLLOWPIN ( 0 1400 ) "
+           "( 2000000 * )\n"
+        << "      NEW metal4 840 + SHAPE STRIPE ( 20000 0 ) ( * 2000000 )\n"
+        << "      NEW metal1 0 ( 20000 1400 ) via1_4 DO 4 BY 1 STEP 400 0 ;\n"
+        << "    - VSS ( * VSS ) + USE GROUND + FIXEDBUMP\n"
+        << "      + FIXED metal1 170 ( 0 0 ) ( 2000000 * 85 ) ;\n"
+        << "END SPECIALNETS\n"
+        << "NETS " << num_nets << " ;\n";
+    for (int i = 0; i < num_nets; ++i) {
+      const int x = (i % 1000) * 380;
+      const int y = (i / 1000) * 2800;
+      out << "    - net_" << i << " ( inst_" << i << " ZN ) ( inst_" << i + 1
+          << " A )";
+      if (i % 7 == 0) {
+        out << " + SOURCE TIMING";
+      }
+      if (i % 11 == 0) {
+        out << " + WEIGHT " << i % 5;
+      }
+      out << " + USE " << (i % 3 == 0 ? "CLOCK" : "SIGNAL") << "\n";
+      if (i % 13 == 0) {
+        out << " ;\n";
+        continue;
+      }
+      out << "      + ROUTED metal2 ";
+      if (i % 5 == 0 && i > 0) {
+        out << "( * " << y << " ) ( " << x << " * )";
+      } else {
+        out << "( " << x << " " << y << " ) ( * " << y + 1400 << " )";
+      }
+      out << "\n      NEW metal1 ( " << x << " " << y << " ) via1_4"
+          << "\n      NEW metal3 TAPER ( " << x << " " << y << " 70 ) ( "
+          << x + 760 << " * 70 ) via2_8"
+          << "\n      NEW metal2 ( " << x << " " << y
+          << " ) RECT ( -70 -70 70 70 ) ;\n";
+    }
+    out << "END NETS\nEND DESIGN\n";
+  }
+  BOOST_TEST_REQUIRE(std::filesystem::file_size(def_file) > (4 << 20));
+
+  utl::Logger logger;
+  dbDatabase* serial_db = readDesign(&logger, 1, def_file.c_str());
+  dbDatabase* parallel_db = readDesign(&logger, 8, def_file.c_str());
+  dbBlock* serial = serial_db->getChip()->getBlock();
+  dbBlock* parallel = parallel_db->getChip()->getBlock();
+
+  BOOST_TEST(serial->getNets().size() == num_nets + 2);
+  BOOST_TEST(writeDesign(&logger, serial, "TestDefParallel_chunks_serial.def")
+             == writeDesign(
+                 &logger, parallel, "TestDefParallel_chunks_parallel.def"));
+
+  dbDatabase::destroy(serial_db);
+  dbDatabase::destroy(parallel_db);
+  std::filesystem::remove(def_file);
+}
+
+BOOST_AUTO_TEST_CASE(test_parallel_write)
+{
+  utl::Logger logger;
+  dbDatabase* db = readDesign(&logger, 1);
+  dbBlock* block = db->getChip()->getBlock();
+
+  auto writeDesign = [&](int threads, const char* def_file) {
+    defout writer(&logger);
+    writer.setThreadCount(threads);
+    BOOST_TEST(writer.writeBlock(block, def_file));
+  };
+  auto contents = [](const char* file) {
+    std::ifstream in(file);
+    std::stringstream buffer;
+    buffer << in.rdbuf();
+    return buffer.str();
+  };
+
+  const std::filesystem::path dir = std::filesystem::temp_directory_path();
+  const std::string serial_def = dir / "TestDefParallel_serial.def";
+  const std::string parallel_def = dir / "TestDefParallel_parallel.def";
+  const std::string gz_def = dir / "TestDefParallel_parallel.def.gz";
+
+  writeDesign(1, serial_def.c_str());
+  writeDesign(4, parallel_def.c_str());
+  BOOST_TEST(contents(serial_def.c_str()) == contents(parallel_def.c_str()));
+
+  auto gzContents = [](const char* file) {
+    gzFile in = gzopen(file, "rb");
+    std::string buffer;
+    char block[1 << 16];
+    int count;
+    while ((count = gzread(in, block, sizeof(block))) > 0) {
+      buffer.append(block, count);
+    }
+    gzclose(in);
+    return buffer;
+  };
+
+  // Compressed output is spooled and deflated in pieces both ways.
+  for (int threads : {1, 4}) {
+    writeDesign(threads, gz_def.c_str());
+    BOOST_TEST(gzContents(gz_def.c_str()) == contents(serial_def.c_str()));
+    dbDatabase* gz_db = readDesign(&logger, 1, gz_def.c_str());
+    dbBlock* gz_block = gz_db->getChip()->getBlock();
+    BOOST_TEST(gz_block->getInsts().size() == block->getInsts().size());
+    BOOST_TEST(gz_block->getNets().size() == block->getNets().size());
+    dbDatabase::destroy(gz_db);
+  }
+
+  dbDatabase::destroy(db);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}  // namespace
+}  // namespace odb
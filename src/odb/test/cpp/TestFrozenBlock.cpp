@@ -0,0 +1,135 @@
+#define BOOST_TEST_MODULE TestFrozenBlock
+#include <atomic>
+#include <boost/test/included/unit_test.hpp>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "helper.h"
+#include "odb/db.h"
+#include "odb/dbWireCodec.h"
+
+namespace odb {
+namespace {
+
+constexpr int num_objects = 2000;
+constexpr int num_threads = 8;
+
+dbDatabase* createFrozenTestDB()
+{
+  dbDatabase* db = createSimpleDB();
+  dbTech* tech = db->getTech();
+  dbBlock* block = db->getChip()->getBlock();
+  dbMaster* and2 = db->findLib("lib1")->findMaster("and2");
+  dbTechLayer* m1 = dbTechLayer::create(tech, "M1", dbTechLayerType::ROUTING);
+
+  for (int i = 0; i < num_objects; ++i) {
+    const std::string idx = std::to_string(i);
+    dbInst* inst = dbInst::create(block, and2, ("i" + idx).c_str());
+    inst->setLocation(i * 10, 0);
+    dbNet* net = dbNet::create(block, ("n" + idx).c_str());
+    inst->findITerm("o")->connect(net);
+    dbIntProperty::create(net, "index", i);
+
+    dbWire* wire = dbWire::create(net);
+    dbWireEncoder encoder;
+    encoder.begin(wire);
+    encoder.newPath(m1, dbWireType::ROUTED);
+    encoder.addPoint(0, i);
+    encoder.addPoint(100 + i, i);
+    encoder.addPoint(100 + i, 2 * i);
+    encoder.end();
+  }
+  return db;
+}
+
+BOOST_AUTO_TEST_SUITE(test_suite)
+
+BOOST_AUTO_TEST_CASE(test_freeze)
+{
+  dbDatabase* db = createFrozenTestDB();
+  dbBlock* block = db->getChip()->getBlock();
+  BOOST_TEST(!block->isFrozen());
+  block->freeze();
+  BOOST_TEST(block->isFrozen());
+
+  // Edits are rejected while frozen.
+  BOOST_CHECK_THROW(dbNet::create(block, "frozen_net"), std::exception);
+  BOOST_CHECK_THROW(block->findInst("i0")->setLocation(5, 5), std::exception);
+  BOOST_CHECK_THROW(block->findNet("n0")->rename("renamed"), std::exception);
+  BOOST_CHECK_THROW(block->findInst("i0")->rename("renamed"), std::exception);
+  BOOST_CHECK_THROW(
+      block->findInst("i0")->setPlacementStatus(dbPlacementStatus::FIRM),
+      std::exception);
+  BOOST_TEST(block->findNet("frozen_net") == nullptr);
+  BOOST_TEST(block->findNet("n0") != nullptr);
+  BOOST_TEST(block->findInst("i0") != nullptr);
+
+  block->unfreeze();
+  BOOST_TEST(!block->isFrozen());
+  BOOST_TEST(dbNet::create(block, "thawed_net") != nullptr);
+  dbDatabase::destroy(db);
+}
+
+BOOST_AUTO_TEST_CASE(test_concurrent_readers)
+{
+  dbDatabase* db = createFrozenTestDB();
+  dbBlock* block = db->getChip()->getBlock();
+  block->freeze();
+  const Rect bbox = block->getBBox()->getBox();
+
+  std::atomic<int> errors = 0;
+  std::vector<std::thread> threads;
+  for (int t = 0; t < num_threads; ++t) {
+    threads.emplace_back([&, t]() {
+      for (int i = t; i < num_objects; i += num_threads) {
+        const std::string idx = std::to_string(i);
+        dbNet* net = block->findNet(("n" + idx).c_str());
+        dbInst* inst = block->findInst(("i" + idx).c_str());
+        dbITerm* iterm = block->findITerm(("i" + idx + "/o").c_str());
+        if (!net || !inst || iterm != inst->findITerm("o")
+            || iterm->getNet() != net) {
+          ++errors;
+          continue;
+        }
+
+        dbIntProperty* prop = dbIntProperty::find(net, "index");
+        if (!prop || prop->getValue() != i) {
+          ++errors;
+        }
+
+        int points = 0;
+        dbWireDecoder decoder;
+        decoder.begin(net->getWire());
+        for (auto op = decoder.next(); op != dbWireDecoder::END_DECODE;
+             op = decoder.next()) {
+          if (op == dbWireDecoder::POINT) {
+            ++points;
+          }
+        }
+        if (points != 3) {
+          ++errors;
+        }
+      }
+
+      int net_count = 0;
+      for (dbNet* net : block->getNets()) {
+        net_count += net->getITerms().size();
+      }
+      if (net_count != num_objects || block->getBBox()->getBox() != bbox) {
+        ++errors;
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  BOOST_TEST(errors == 0);
+  dbDatabase::destroy(db);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}  // namespace
+}  // namespace odb
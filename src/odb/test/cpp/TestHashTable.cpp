@@ -0,0 +1,124 @@
+#define BOOST_TEST_MODULE TestHashTable
+#include <boost/test/included/unit_test.hpp>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+#include "helper.h"
+#include "odb/db.h"
+
+namespace odb {
+namespace {
+
+constexpr int num_nets = 10000;
+
+std::string netName(int i)
+{
+  return "net_" + std::to_string(i);
+}
+
+BOOST_AUTO_TEST_SUITE(test_suite)
+
+BOOST_AUTO_TEST_CASE(test_insert_remove)
+{
+  dbDatabase* db = createSimpleDB();
+  dbBlock* block = db->getChip()->getBlock();
+  block->reserveNameTables(0, num_nets / 2);
+
+  for (int i = 0; i < num_nets; ++i) {
+    BOOST_TEST(dbNet::create(block, netName(i).c_str()) != nullptr);
+  }
+  BOOST_TEST(dbNet::create(block, netName(0).c_str()) == nullptr);
+
+  // Remove every other net so the table shrinks and entries shift.
+  for (int i = 0; i < num_nets; i += 2) {
+    dbNet::destroy(block->findNet(netName(i).c_str()));
+  }
+  for (int i = 0; i < num_nets; ++i) {
+    dbNet* net = block->findNet(netName(i).c_str());
+    if (i % 2) {
+      BOOST_TEST(net != nullptr);
+      BOOST_TEST(net->getName() == netName(i));
+    } else {
+      BOOST_TEST(net == nullptr);
+    }
+  }
+
+  dbNet* net = block->findNet(netName(1).c_str());
+  BOOST_TEST(net->rename("renamed"));
+  BOOST_TEST(block->findNet(netName(1).c_str()) == nullptr);
+  BOOST_TEST(block->findNet("renamed") == net);
+  dbDatabase::destroy(db);
+}
+
+BOOST_AUTO_TEST_CASE(test_read_write)
+{
+  dbDatabase* db = createSimpleDB();
+  dbBlock* block = db->getChip()->getBlock();
+  for (int i = 0; i < num_nets; ++i) {
+    dbNet::create(block, netName(i).c_str());
+  }
+
+  std::stringstream stream;
+  db->write(stream);
+  dbDatabase* db2 = dbDatabase::create();
+  db2->read(stream);
+
+  dbBlock* block2 = db2->getChip()->getBlock();
+  for (int i = 0; i < num_nets; ++i) {
+    dbNet* net = block2->findNet(netName(i).c_str());
+    BOOST_TEST(net != nullptr);
+    BOOST_TEST(net->getId() == block->findNet(netName(i).c_str())->getId());
+  }
+  BOOST_TEST(block2->findNet("missing") == nullptr);
+  dbDatabase::destroy(db);
+  dbDatabase::destroy(db2);
+}
+
+BOOST_AUTO_TEST_CASE(test_legacy_schema)
+{
+  // data/design.odb predates db_schema_hash_table_open_addressing, so its
+  // tables are rebuilt from the chained buckets while reading.
+  std::ifstream file("data/design.odb", std::ios::binary);
+  BOOST_TEST_REQUIRE(file.good());
+  dbDatabase* db = dbDatabase::create();
+  db->read(file);
+
+  dbBlock* block = db->getChip()->getBlock();
+  BOOST_TEST(block->getNets().size() > 0);
+  BOOST_TEST(block->getInsts().size() > 0);
+  for (dbNet* net : block->getNets()) {
+    BOOST_TEST(block->findNet(net->getConstName()) == net);
+  }
+  for (dbInst* inst : block->getInsts()) {
+    BOOST_TEST(block->findInst(inst->getConstName()) == inst);
+  }
+  for (dbBTerm* bterm : block->getBTerms()) {
+    BOOST_TEST(block->findBTerm(bterm->getConstName()) == bterm);
+  }
+  for (dbLib* lib : db->getLibs()) {
+    for (dbMaster* master : lib->getMasters()) {
+      BOOST_TEST(lib->findMaster(master->getConstName()) == master);
+    }
+  }
+  BOOST_TEST(block->findNet("missing") == nullptr);
+
+  // The rebuilt tables are written in the current layout.
+  std::stringstream stream;
+  db->write(stream);
+  dbDatabase* db2 = dbDatabase::create();
+  db2->read(stream);
+  dbBlock* block2 = db2->getChip()->getBlock();
+  for (dbNet* net : block->getNets()) {
+    dbNet* net2 = block2->findNet(net->getConstName());
+    BOOST_TEST(net2 != nullptr);
+    BOOST_TEST(net2->getId() == net->getId());
+  }
+  dbDatabase::destroy(db);
+  dbDatabase::destroy(db2);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}  // namespace
+}  // namespace odb
@@ -35,6 +35,9 @@
 
 #include "HungarianMatching.h"
 
+#include <algorithm>
+#include <numeric>
+
 #include "utl/Logger.h"
 
 namespace ppl {
@@ -65,6 +68,17 @@ HungarianMatching::HungarianMatching(const Section& section,
 
 void HungarianMatching::findAssignment()
 {
+  // The dense matrix and the Hungarian solver grow cubically with the
+  // section size, so large sections are matched sparsely.  Group pins are
+  // placed by findAssignmentForGroups and aren't matched here.
+  const int num_pins = std::count_if(
+      pin_indices_.begin(), pin_indices_.end(), [&](int idx) {
+        return !netlist_->getIoPin(idx).isInGroup();
+      });
+  if (num_pins >= sparse_min_pins_ && findSparseAssignment()) {
+    return;
+  }
+
   createMatrix();
   if (!hungarian_matrix_.empty()) {
     hungarian_solver_.solve(hungarian_matrix_, assignment_);
@@ -95,6 +109,121 @@ void HungarianMatching::createMatrix()
   }
 }
 
+bool HungarianMatching::findSparseAssignment()
+{
+  hungarian_matrix_.clear();
+
+  // The rows and columns of the dense matrix
+  std::vector<int> slot_indices;
+  for (int i = begin_slot_; i <= end_slot_; ++i) {
+    if (!slots_[i].blocked) {
+      slot_indices.push_back(i);
+    }
+  }
+  std::vector<int> pins;
+  for (int idx : pin_indices_) {
+    if (!netlist_->getIoPin(idx).isInGroup()) {
+      pins.push_back(idx);
+    }
+  }
+
+  // The HPWL of a pin's net is the box of its sinks extended to the slot.
+  const int num_pins = pins.size();
+  const int num_cols = slot_indices.size();
+  std::vector<Rect> sink_boxes(num_pins);
+  std::vector<InstancePin> sinks;
+  for (int pin = 0; pin < num_pins; pin++) {
+    sinks.clear();
+    netlist_->getSinksOfIO(pins[pin], sinks);
+    sink_boxes[pin].mergeInit();
+    for (const InstancePin& sink : sinks) {
+      sink_boxes[pin].merge(Rect(sink.getPos(), sink.getPos()));
+    }
+  }
+  auto cost = [&](int pin, int col) {
+    const Rect& box = sink_boxes[pin];
+    if (box.isInverted()) {
+      return 0;
+    }
+    const Point& pos = slots_[slot_indices[col]].pos;
+    return (std::max(box.xMax(), pos.x()) - std::min(box.xMin(), pos.x()))
+           + (std::max(box.yMax(), pos.y()) - std::min(box.yMin(), pos.y()));
+  };
+
+  // Slots of an edge section share one coordinate, so the cost of a pin
+  // only grows moving away from its sinks along the edge and its cheapest
+  // slots are found by walking out from there.
+  SparseAssignment::CandidateFn candidates;
+  const bool along_x = edge_ == Edge::bottom || edge_ == Edge::top;
+  const bool along_y = edge_ == Edge::left || edge_ == Edge::right;
+  const bool on_line
+      = (along_x || along_y)
+        && std::all_of(
+            slot_indices.begin(), slot_indices.end(), [&](int slot_idx) {
+              const Point& first = slots_[slot_indices[0]].pos;
+              const Point& pos = slots_[slot_idx].pos;
+              return along_x ? pos.y() == first.y() : pos.x() == first.x();
+            });
+  std::vector<int> sorted_cols(num_cols);
+  std::vector<int> sorted_coords;
+  if (on_line) {
+    auto coord = [&](int col) {
+      const Point& pos = slots_[slot_indices[col]].pos;
+      return along_x ? pos.x() : pos.y();
+    };
+    std::iota(sorted_cols.begin(), sorted_cols.end(), 0);
+    std::stable_sort(sorted_cols.begin(),
+                     sorted_cols.end(),
+                     [&](int a, int b) { return coord(a) < coord(b); });
+    for (int col : sorted_cols) {
+      sorted_coords.push_back(coord(col));
+    }
+
+    candidates = [&](int pin,
+                     int num_candidates,
+                     std::vector<std::pair<int, int>>& pin_candidates) {
+      const Rect& box = sink_boxes[pin];
+      const int low = box.isInverted() ? 0 : along_x ? box.xMin() : box.yMin();
+      int right = std::lower_bound(sorted_coords.begin(),
+                                   sorted_coords.end(),
+                                   low)
+                  - sorted_coords.begin();
+      int left = right - 1;
+      for (int i = 0; i < num_candidates; i++) {
+        const int right_cost = right < num_cols
+                                   ? cost(pin, sorted_cols[right])
+                                   : std::numeric_limits<int>::max();
+        const int left_cost = left >= 0 ? cost(pin, sorted_cols[left])
+                                        : std::numeric_limits<int>::max();
+        if (right_cost <= left_cost) {
+          pin_candidates.emplace_back(sorted_cols[right++], right_cost);
+        } else {
+          pin_candidates.emplace_back(sorted_cols[left--], left_cost);
+        }
+      }
+    };
+  }
+
+  SparseAssignment solver(num_pins, num_cols, cost, candidates);
+  std::vector<int> pin_to_col;
+  if (!solver.solve(pin_to_col)) {
+    logger_->warn(utl::PPL,
+                  113,
+                  "Section with {} pins and {} slots cannot be matched "
+                  "sparsely, using the dense matching.",
+                  num_pins,
+                  num_cols);
+    return false;
+  }
+  assignment_.assign(non_blocked_slots_, -1);
+  for (int pin = 0; pin < num_pins; pin++) {
+    if (pin_to_col[pin] < non_blocked_slots_) {
+      assignment_[pin_to_col[pin]] = pin;
+    }
+  }
+  return true;
+}
+
 inline bool samePos(Point& a, Point& b)
 {
   return (a.x() == b.x() && a.y() == b.y());
@@ -120,7 +249,8 @@ void HungarianMatching::getFinalAssignment(std::vector<IOPin>& assignment,
           slot_index++;
           continue;
         }
-        if (hungarian_matrix_[row][col] == hungarian_fail) {
+        if (!hungarian_matrix_.empty()
+            && hungarian_matrix_[row][col] == hungarian_fail) {
           logger_->warn(utl::PPL,
                         33,
                         "I/O pin {} cannot be placed in the specified region. "
@@ -46,6 +46,7 @@
 #include "Hungarian.h"
 #include "Netlist.h"
 #include "Slots.h"
+#include "SparseAssignment.h"
 #include "ppl/IOPlacer.h"
 
 namespace utl {
@@ -99,7 +100,13 @@ class HungarianMatching
   Logger* logger_;
   odb::dbDatabase* db_;
 
+  // Sections with at least this many non-group pins skip the dense matrix
+  static constexpr int sparse_min_pins_ = 1000;
+
   void createMatrix();
+  // Returns false, leaving the section to the dense matching, if the pins
+  // can't all be matched to slots.
+  bool findSparseAssignment();
   void createMatrixForGroups();
   void assignMirroredPins(IOPin& io_pin,
                           MirroredPins& mirrored_pins,
@@ -50,6 +50,7 @@
 #include "ppl/AbstractIOPlacerRenderer.h"
 #include "utl/Logger.h"
 #include "utl/algorithms.h"
+#include "utl/exception.h"
 
 namespace ppl {
 
@@ -2003,9 +2004,18 @@ void IOPlacer::findPinAssignment(std::vector<Section>& sections,
     }
   }
 
-  for (auto& match : hg_vec) {
-    match.findAssignmentForGroups();
+  // The sections are matched independently of each other
+  const int threads = parms_->getNumThreads();
+  utl::ThreadException exception;
+#pragma omp parallel for num_threads(threads) schedule(dynamic)
+  for (int i = 0; i < hg_vec.size(); i++) {
+    try {
+      hg_vec[i].findAssignmentForGroups();
+    } catch (...) {
+      exception.capture();
+    }
   }
+  exception.rethrow();
 
   for (auto& match : hg_vec) {
     match.getAssignmentForGroups(
@@ -2018,9 +2028,15 @@ void IOPlacer::findPinAssignment(std::vector<Section>& sections,
     updateSection(sec, slots);
   }
 
-  for (auto& match : hg_vec) {
-    match.findAssignment();
+#pragma omp parallel for num_threads(threads) schedule(dynamic)
+  for (int i = 0; i < hg_vec.size(); i++) {
+    try {
+      hg_vec[i].findAssignment();
+    } catch (...) {
+      exception.capture();
+    }
   }
+  exception.rethrow();
 
   if (!mirrored_pins_.empty()) {
     for (auto& match : hg_vec) {
@@ -232,6 +232,8 @@ add_pin_group(PinList *pin_list, bool order)
 void
 run_io_placement(bool randomMode)
 {
+  getIOPlacer()->getParameters()->setNumThreads(
+      ord::OpenRoad::openRoad()->getThreadCount());
   getIOPlacer()->run(randomMode);
 }
 
@@ -0,0 +1,236 @@
+/////////////////////////////////////////////////////////////////////////////
+//
+// BSD 3-Clause License
+//
+// Copyright (c) 2024, The Regents of the University of California
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include "SparseAssignment.h"
+
+#include <algorithm>
+#include <limits>
+#include <numeric>
+#include <queue>
+#include <tuple>
+
+namespace ppl {
+
+SparseAssignment::SparseAssignment(int num_rows,
+                                   int num_cols,
+                                   CostFn cost,
+                                   CandidateFn candidates)
+    : num_rows_(num_rows),
+      num_cols_(num_cols),
+      cost_(std::move(cost)),
+      find_candidates_(std::move(candidates))
+{
+}
+
+bool SparseAssignment::solve(std::vector<int>& row_to_col)
+{
+  if (num_rows_ > num_cols_) {
+    return false;
+  }
+
+  candidates_.resize(num_rows_);
+  num_candidates_.assign(num_rows_, std::min(initial_candidates_, num_cols_));
+  std::vector<int> grown_rows(num_rows_);
+  std::iota(grown_rows.begin(), grown_rows.end(), 0);
+  while (true) {
+    for (int row : grown_rows) {
+      findCandidates(row);
+    }
+    grown_rows.clear();
+
+    const bool matched = matchRows();
+    for (int row = 0; row < num_rows_; row++) {
+      if (num_candidates_[row] < num_cols_
+          && (!matched || !isRowOptimal(row))) {
+        num_candidates_[row] = std::min(num_candidates_[row] * 2, num_cols_);
+        grown_rows.push_back(row);
+      }
+    }
+
+    // With every column as a candidate the search is exhaustive.
+    if (grown_rows.empty()) {
+      if (!matched) {
+        return false;
+      }
+      row_to_col = row_match_;
+      return true;
+    }
+  }
+}
+
+void SparseAssignment::findCandidates(int row)
+{
+  std::vector<std::pair<int, int>>& row_candidates = candidates_[row];
+  row_candidates.clear();
+  if (find_candidates_) {
+    find_candidates_(row, num_candidates_[row], row_candidates);
+    return;
+  }
+
+  std::vector<std::pair<int, int>> costs(num_cols_);
+  for (int col = 0; col < num_cols_; col++) {
+    costs[col] = {cost_(row, col), col};
+  }
+  std::nth_element(costs.begin(),
+                   costs.begin() + num_candidates_[row] - 1,
+                   costs.end());
+  for (int i = 0; i < num_candidates_[row]; i++) {
+    row_candidates.emplace_back(costs[i].second, costs[i].first);
+  }
+}
+
+bool SparseAssignment::matchRows()
+{
+  row_potential_.assign(num_rows_, 0);
+  col_potential_.assign(num_cols_, 0);
+  row_match_.assign(num_rows_, -1);
+  col_match_.assign(num_cols_, -1);
+  dist_.assign(num_cols_, std::numeric_limits<int64_t>::max());
+  prev_row_.assign(num_cols_, -1);
+  done_.assign(num_cols_, false);
+
+  for (int row = 0; row < num_rows_; row++) {
+    if (!matchRow(row)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// Dijkstra over the reduced costs from the unmatched row to the nearest
+// free column, then augment along that path.  The reduced costs of the
+// candidate pairs stay non-negative and those of matched pairs stay zero.
+bool SparseAssignment::matchRow(int row)
+{
+  // Among equally distant columns, free ones are popped first so the
+  // search ends as early as possible.
+  using Entry = std::tuple<int64_t, bool, int>;
+  std::priority_queue<Entry, std::vector<Entry>, std::greater<>> queue;
+
+  int64_t min_cost = std::numeric_limits<int64_t>::max();
+  for (const auto& [col, cost] : candidates_[row]) {
+    min_cost = std::min(min_cost, cost - col_potential_[col]);
+  }
+  row_potential_[row] = min_cost;
+
+  visited_.clear();
+  auto relax = [&](int from_row, int64_t from_dist) {
+    for (const auto& [col, cost] : candidates_[from_row]) {
+      const int64_t dist = from_dist + cost - row_potential_[from_row]
+                           - col_potential_[col];
+      if (!done_[col] && dist < dist_[col]) {
+        if (dist_[col] == std::numeric_limits<int64_t>::max()) {
+          visited_.push_back(col);
+        }
+        dist_[col] = dist;
+        prev_row_[col] = from_row;
+        queue.emplace(dist, col_match_[col] != -1, col);
+      }
+    }
+  };
+  relax(row, 0);
+
+  int free_col = -1;
+  int64_t path_dist = 0;
+  std::vector<int> done_cols;
+  while (!queue.empty()) {
+    const auto [dist, matched, col] = queue.top();
+    queue.pop();
+    if (done_[col] || dist > dist_[col]) {
+      continue;
+    }
+    done_[col] = true;
+    done_cols.push_back(col);
+    if (col_match_[col] == -1) {
+      free_col = col;
+      path_dist = dist;
+      break;
+    }
+    relax(col_match_[col], dist);
+  }
+
+  if (free_col != -1) {
+    row_potential_[row] += path_dist;
+    for (int col : done_cols) {
+      const int64_t delta = path_dist - dist_[col];
+      col_potential_[col] -= delta;
+      if (col_match_[col] != -1) {
+        row_potential_[col_match_[col]] += delta;
+      }
+    }
+
+    int col = free_col;
+    while (true) {
+      const int prev_row = prev_row_[col];
+      const int next_col = row_match_[prev_row];
+      row_match_[prev_row] = col;
+      col_match_[col] = prev_row;
+      if (prev_row == row) {
+        break;
+      }
+      col = next_col;
+    }
+  }
+
+  for (int col : visited_) {
+    dist_[col] = std::numeric_limits<int64_t>::max();
+    done_[col] = false;
+  }
+  return free_col != -1;
+}
+
+// The potentials prove the row optimally matched if no pair of the row,
+// candidate or not, has a negative reduced cost.  Column potentials are
+// never positive, so the columns left out can only be cheaper than the
+// candidates when the row potential exceeds the costliest candidate.
+bool SparseAssignment::isRowOptimal(int row) const
+{
+  int max_candidate_cost = 0;
+  for (const auto& [col, cost] : candidates_[row]) {
+    max_candidate_cost = std::max(max_candidate_cost, cost);
+  }
+  if (row_potential_[row] <= max_candidate_cost) {
+    return true;
+  }
+
+  for (int col = 0; col < num_cols_; col++) {
+    if (cost_(row, col) - row_potential_[row] - col_potential_[col] < 0) {
+      return false;
+    }
+  }
+  return true;
+}
+
+}  // namespace ppl
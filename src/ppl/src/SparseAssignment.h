@@ -0,0 +1,99 @@
+/////////////////////////////////////////////////////////////////////////////
+//
+// BSD 3-Clause License
+//
+// Copyright (c) 2024, The Regents of the University of California
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <utility>
+#include <vector>
+
+namespace ppl {
+
+// Min-cost assignment of each row to a distinct column (num_rows <=
+// num_cols), for sections too large for the dense Hungarian matrix.
+// Each row only considers its cheapest candidate columns and the rows are
+// matched by successive shortest augmenting paths.  The dual potentials
+// then bound the reduced cost of every pair left out; a row whose bound
+// can't rule out a better column gets more candidates and the assignment
+// is recomputed, so the result is optimal as with the dense solver.
+class SparseAssignment
+{
+ public:
+  using CostFn = std::function<int(int row, int col)>;
+  // Fills the num_candidates cheapest (column, cost) pairs of row.
+  using CandidateFn
+      = std::function<void(int row,
+                           int num_candidates,
+                           std::vector<std::pair<int, int>>& candidates)>;
+
+  // Without a candidate function every column of a row is costed to find
+  // its cheapest ones.
+  SparseAssignment(int num_rows,
+                   int num_cols,
+                   CostFn cost,
+                   CandidateFn candidates = nullptr);
+
+  // Fills row_to_col; returns false if the rows can't all be matched.
+  bool solve(std::vector<int>& row_to_col);
+
+ private:
+  void findCandidates(int row);
+  bool matchRows();
+  bool matchRow(int row);
+  bool isRowOptimal(int row) const;
+
+  int num_rows_;
+  int num_cols_;
+  CostFn cost_;
+  CandidateFn find_candidates_;
+  // (column, cost) candidates of each row
+  std::vector<std::vector<std::pair<int, int>>> candidates_;
+  std::vector<int> num_candidates_;
+  std::vector<int64_t> row_potential_;
+  std::vector<int64_t> col_potential_;
+  std::vector<int> row_match_;
+  std::vector<int> col_match_;
+
+  // per augmenting path search
+  std::vector<int64_t> dist_;
+  std::vector<int> prev_row_;
+  std::vector<char> done_;
+  std::vector<int> visited_;
+
+  static constexpr int initial_candidates_ = 16;
+};
+
+}  // namespace ppl
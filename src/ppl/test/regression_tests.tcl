@@ -114,3 +114,6 @@ record_tests {
   #ppl_man_tcl_check
   #ppl_readme_msgs_check
 }
+record_pass_fail_tests {
+  sparse_matching
+}
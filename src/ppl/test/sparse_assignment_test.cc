@@ -0,0 +1,174 @@
+/////////////////////////////////////////////////////////////////////////////
+//
+// BSD 3-Clause License
+//
+// Copyright (c) 2024, The Regents of the University of California
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <set>
+#include <vector>
+
+#include "Hungarian.h"
+#include "SparseAssignment.h"
+#include "gtest/gtest.h"
+
+namespace ppl {
+
+using Matrix = std::vector<std::vector<int>>;
+
+// Cost of row_to_col; the columns must be distinct.
+int64_t assignmentCost(const Matrix& costs, const std::vector<int>& row_to_col)
+{
+  std::set<int> cols;
+  int64_t cost = 0;
+  for (int row = 0; row < costs.size(); row++) {
+    const int col = row_to_col[row];
+    EXPECT_GE(col, 0);
+    EXPECT_LT(col, costs[row].size());
+    EXPECT_TRUE(cols.insert(col).second);
+    cost += costs[row][col];
+  }
+  return cost;
+}
+
+// Optimal cost from the dense solver used by HungarianMatching, which takes
+// the matrix with the columns as rows.
+int64_t munkresCost(const Matrix& costs)
+{
+  const int num_rows = costs.size();
+  const int num_cols = costs[0].size();
+  Matrix transposed(num_cols, std::vector<int>(num_rows));
+  for (int row = 0; row < num_rows; row++) {
+    for (int col = 0; col < num_cols; col++) {
+      transposed[col][row] = costs[row][col];
+    }
+  }
+  HungarianAlgorithm munkres;
+  std::vector<int> col_to_row;
+  munkres.solve(transposed, col_to_row);
+
+  std::vector<int> row_to_col(num_rows, -1);
+  for (int col = 0; col < num_cols; col++) {
+    if (col_to_row[col] >= 0) {
+      row_to_col[col_to_row[col]] = col;
+    }
+  }
+  return assignmentCost(costs, row_to_col);
+}
+
+Matrix randomCosts(int num_rows, int num_cols, int max_cost, unsigned seed)
+{
+  std::mt19937 rng(seed);
+  std::uniform_int_distribution<int> dist(0, max_cost);
+  Matrix costs(num_rows, std::vector<int>(num_cols));
+  for (auto& row : costs) {
+    for (int& cost : row) {
+      cost = dist(rng);
+    }
+  }
+  return costs;
+}
+
+TEST(SparseAssignmentTest, MatchesMunkres)
+{
+  const int sizes[][2] = {{1, 1}, {5, 5}, {20, 40}, {60, 60}, {100, 130}};
+  for (const auto& size : sizes) {
+    for (const int max_cost : {3, 1000}) {
+      for (unsigned seed = 0; seed < 5; seed++) {
+        const Matrix costs = randomCosts(size[0], size[1], max_cost, seed);
+        auto cost = [&](int row, int col) { return costs[row][col]; };
+        SparseAssignment solver(size[0], size[1], cost);
+        std::vector<int> row_to_col;
+        ASSERT_TRUE(solver.solve(row_to_col));
+        EXPECT_EQ(assignmentCost(costs, row_to_col), munkresCost(costs));
+      }
+    }
+  }
+}
+
+// Pins on a line matched to slots on the same line, with the candidates
+// walked out from each pin as HungarianMatching does for an edge.
+TEST(SparseAssignmentTest, CandidateFunction)
+{
+  const int num_rows = 200;
+  const int num_cols = 300;
+  std::mt19937 rng(1);
+  std::uniform_int_distribution<int> dist(0, 10 * num_cols);
+  std::vector<int> pins(num_rows);
+  for (int& pin : pins) {
+    pin = dist(rng);
+  }
+  Matrix costs(num_rows, std::vector<int>(num_cols));
+  for (int row = 0; row < num_rows; row++) {
+    for (int col = 0; col < num_cols; col++) {
+      costs[row][col] = std::abs(pins[row] - 10 * col);
+    }
+  }
+
+  auto candidates = [&](int row,
+                        int num_candidates,
+                        std::vector<std::pair<int, int>>& row_candidates) {
+    int right = std::clamp((pins[row] + 9) / 10, 0, num_cols);
+    int left = right - 1;
+    for (int i = 0; i < num_candidates; i++) {
+      if (left < 0 || (right < num_cols
+                       && costs[row][right] <= costs[row][left])) {
+        row_candidates.emplace_back(right, costs[row][right]);
+        right++;
+      } else {
+        row_candidates.emplace_back(left, costs[row][left]);
+        left--;
+      }
+    }
+  };
+  SparseAssignment solver(
+      num_rows,
+      num_cols,
+      [&](int row, int col) { return costs[row][col]; },
+      candidates);
+  std::vector<int> row_to_col;
+  ASSERT_TRUE(solver.solve(row_to_col));
+  EXPECT_EQ(assignmentCost(costs, row_to_col), munkresCost(costs));
+}
+
+TEST(SparseAssignmentTest, MoreRowsThanColumns)
+{
+  const Matrix costs = randomCosts(10, 8, 100, 0);
+  SparseAssignment solver(
+      10, 8, [&](int row, int col) { return costs[row][col]; });
+  std::vector<int> row_to_col;
+  EXPECT_FALSE(solver.solve(row_to_col));
+}
+
+}  // namespace ppl
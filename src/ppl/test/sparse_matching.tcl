@@ -0,0 +1,55 @@
+# A left edge section with 1200 pins, large enough for the sparse matching.
+# Every pin has one sink and the sinks are ten tracks apart, so each pin's
+# optimal slot is the track nearest its sink.
+source "helpers.tcl"
+read_lef Nangate45/Nangate45.lef
+
+set num_pins 1200
+set def_file [make_result_file sparse_matching.def]
+set stream [open $def_file w]
+puts $stream "VERSION 5.8 ;"
+puts $stream "DIVIDERCHAR \"/\" ;"
+puts $stream "BUSBITCHARS \"\[\]\" ;"
+puts $stream "DESIGN sparse_matching ;"
+puts $stream "UNITS DISTANCE MICRONS 2000 ;"
+puts $stream "DIEAREA ( 0 0 ) ( 400000 3400000 ) ;"
+puts $stream "TRACKS X 190 DO 1052 STEP 380 LAYER metal2 ;"
+puts $stream "TRACKS Y 140 DO 12140 STEP 280 LAYER metal3 ;"
+puts $stream "COMPONENTS $num_pins ;"
+for {set i 0} {$i < $num_pins} {incr i} {
+  puts $stream "- inv$i INV_X1 + PLACED ( 20000 [expr 20000 + 2800 * $i] ) N ;"
+}
+puts $stream "END COMPONENTS"
+puts $stream "PINS $num_pins ;"
+for {set i 0} {$i < $num_pins} {incr i} {
+  puts $stream "- in$i + NET in$i + DIRECTION INPUT + USE SIGNAL ;"
+}
+puts $stream "END PINS"
+puts $stream "NETS $num_pins ;"
+for {set i 0} {$i < $num_pins} {incr i} {
+  puts $stream "- in$i ( PIN in$i ) ( inv$i A ) ;"
+}
+puts $stream "END NETS"
+puts $stream "END DESIGN"
+close $stream
+
+read_def $def_file
+
+ppl::set_slots_per_section 13000
+place_pins -hor_layers metal3 -ver_layers metal2 -corner_avoidance 0 \
+  -min_distance 0.12 -exclude top:* -exclude bottom:* -exclude right:*
+
+# INV_X1/A is centered 0.6125 um above the cell origin.
+set block [ord::get_db_block]
+for {set i 0} {$i < $num_pins} {incr i} {
+  set box [[$block findBTerm in$i] getBBox]
+  set sink_y [expr 20000 + 2800 * $i + 1225]
+  set pin_y [expr ([$box yMin] + [$box yMax]) / 2]
+  if { [$box xMin] != 0 || abs($pin_y - $sink_y) > 140 } {
+    puts "fail - in$i at ([$box xMin], $pin_y), sink y $sink_y"
+    exit 1
+  }
+}
+
+puts "pass"
+exit
@@ -69,6 +69,12 @@ enum class GeneratedSourceType
   BUMPS
 };
 
+enum class SolverType
+{
+  LU,  // sparse LU factorization
+  CG   // incomplete Cholesky preconditioned conjugate gradient
+};
+
 class PDNSim : public odb::dbBlockCallBackObj
 {
  public:
@@ -84,6 +90,19 @@ class PDNSim : public odb::dbBlockCallBackObj
     int strap_track_pitch = 10;
   };
 
+  struct TransientSettings
+  {
+    // Intrinsic cell capacitance per area in F/m^2 (10 fF/um^2), the
+    // order of the gate, junction and well capacitance of standard cells.
+    // Used when the user gives no -cap_density.
+    static constexpr double default_cap_density = 0.01;
+
+    // Seconds, 0 uses a twentieth of the fastest clock period
+    double time_step = 0.0;
+    // Intrinsic cell capacitance per area in F/m^2
+    double cap_density = default_cap_density;
+  };
+
   using IRDropByPoint = std::map<odb::Point, double>;
   using IRDropByLayer = std::map<odb::dbTechLayer*, IRDropByPoint>;
 
@@ -103,7 +122,10 @@ class PDNSim : public odb::dbBlockCallBackObj
                         bool enable_em,
                         const std::string& em_file,
                         const std::string& error_file,
-                        const std::string& voltage_source_file);
+                        const std::string& voltage_source_file,
+                        SolverType solver_type = SolverType::LU,
+                        int threads = 1,
+                        const TransientSettings* transient = nullptr);
   void writeSpiceNetwork(odb::dbNet* net,
                          sta::Corner* corner,
                          GeneratedSourceType source_type,
@@ -117,6 +139,8 @@ class PDNSim : public odb::dbBlockCallBackObj
                          bool floorplanning,
                          const std::string& error_file);
   void setDebugGui(bool enable);
+  // Threads used to build the grid network of new solvers.
+  void setThreadCount(int threads) { threads_ = threads; }
 
   void clearSolvers();
 
@@ -143,6 +167,7 @@ class PDNSim : public odb::dbBlockCallBackObj
   std::unique_ptr<IRDropDataSource> heatmap_;
 
   bool debug_gui_enabled_ = false;
+  int threads_ = 1;
 
   GeneratedSourceSettings generated_source_settings_;
 
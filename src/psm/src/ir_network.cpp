@@ -32,6 +32,7 @@
 
 #include "ir_network.h"
 
+#include <algorithm>
 #include <fstream>
 #include <list>
 
@@ -44,8 +45,14 @@
 
 namespace psm {
 
-IRNetwork::IRNetwork(odb::dbNet* net, utl::Logger* logger, bool floorplanning)
-    : net_(net), logger_(logger), floorplanning_(floorplanning)
+IRNetwork::IRNetwork(odb::dbNet* net,
+                     utl::Logger* logger,
+                     bool floorplanning,
+                     int threads)
+    : net_(net),
+      logger_(logger),
+      floorplanning_(floorplanning),
+      threads_(std::max(1, threads))
 {
   if (!net_->getSigType().isSupply()) {
     logger_->error(utl::PSM, 87, "{} is not a supply net.", net_->getName());
@@ -474,65 +481,73 @@ void IRNetwork::generateRoutingLayerShapesAndNodes()
 
   const TerminalTree terminal_nodes = getTerminalTree(terminals);
 
-  // Simplify shapes
-  std::vector<std::pair<odb::dbTechLayer*, Polygon90>> all_poly_shapes;
+  // Simplify shapes, each layer is independent
+  std::vector<std::pair<odb::dbTechLayer*, Polygon90Set*>> layer_shapes;
   for (auto& [layer, shapes] : shapes_by_layer) {
-    const utl::DebugScopedTimer layer_timer(
-        logger_,
-        utl::PSM,
-        "timer",
-        1,
-        fmt::format("Convert shapes to polygons shapes on {}: {{}}",
-                    layer->getName()));
-
-    std::vector<Polygon90> shape_polygons;
-    shapes.get_polygons(shape_polygons);
-
-    debugPrint(logger_,
-               utl::PSM,
-               "timer",
-               1,
-               "Shape reduction on {}: {}",
-               layer->getName(),
-               layer_timer);
+    layer_shapes.emplace_back(layer, &shapes);
+  }
+  std::vector<std::vector<Polygon90>> layer_polygons(layer_shapes.size());
+  const utl::Timer reduction_timer;
+#pragma omp parallel for num_threads(threads_) schedule(dynamic)
+  for (std::size_t i = 0; i < layer_shapes.size(); i++) {
+    layer_shapes[i].second->get_polygons(layer_polygons[i]);
+  }
+  debugPrint(
+      logger_, utl::PSM, "timer", 1, "Shape reduction: {}", reduction_timer);
 
+  std::vector<std::pair<odb::dbTechLayer*, const Polygon90*>> all_poly_shapes;
+  for (std::size_t i = 0; i < layer_shapes.size(); i++) {
+    auto& [layer, shapes] = layer_shapes[i];
     debugPrint(logger_,
                utl::PSM,
                "construct",
                1,
                "Shapes on {}: {} reduced to {}",
                layer->getName(),
-               shapes.size(),
-               shape_polygons.size());
+               shapes->size(),
+               layer_polygons[i].size());
 
-    for (const auto& shape_poly : shape_polygons) {
-      all_poly_shapes.emplace_back(layer, shape_poly);
+    for (const auto& shape_poly : layer_polygons[i]) {
+      all_poly_shapes.emplace_back(layer, &shape_poly);
     }
   }
   shapes_by_layer.clear();
 
+  // Polygons are disjoint regions of a layer, so they are split into
+  // rectangles in parallel and the results appended in polygon order.
+  struct PolygonResult
+  {
+    std::vector<std::unique_ptr<Node>> nodes;
+    std::vector<std::unique_ptr<Shape>> shapes;
+    std::map<Shape*, std::set<Node*>> term_nodes;
+  };
   const utl::Timer generate_timer;
-  std::vector<std::unique_ptr<Node>> poly_nodes;
-  std::vector<std::unique_ptr<Shape>> poly_shapes;
-  std::map<Shape*, std::set<Node*>> shape_term_nodes;
-  for (const auto& [layer, shape_poly] : all_poly_shapes) {
+  std::vector<PolygonResult> poly_results(all_poly_shapes.size());
+#pragma omp parallel for num_threads(threads_) schedule(dynamic, 16)
+  for (std::size_t i = 0; i < all_poly_shapes.size(); i++) {
+    const auto& [layer, shape_poly] = all_poly_shapes[i];
+    auto& result = poly_results[i];
     processPolygonToRectangles(layer,
-                               shape_poly,
+                               *shape_poly,
                                terminal_nodes,
-                               poly_shapes,
-                               poly_nodes,
-                               shape_term_nodes);
+                               result.shapes,
+                               result.nodes,
+                               result.term_nodes);
   }
 
   debugPrint(
       logger_, utl::PSM, "timer", 1, "Shape generation: {}", generate_timer);
 
-  for (auto& node : poly_nodes) {
-    nodes_[node->getLayer()].push_back(std::move(node));
-  }
-  for (auto& shape : poly_shapes) {
-    shapes_[shape->getLayer()].push_back(std::move(shape));
+  for (auto& result : poly_results) {
+    for (auto& node : result.nodes) {
+      nodes_[node->getLayer()].push_back(std::move(node));
+    }
+    for (auto& shape : result.shapes) {
+      shapes_[shape->getLayer()].push_back(std::move(shape));
+    }
   }
+  poly_results.clear();
+  layer_polygons.clear();
 
   sortShapes();
 
@@ -576,7 +591,7 @@ void IRNetwork::generateCutNodesForSBox(
   }
 
   const int min_pitch_
-      = std::min(min_node_pitch_[bottom], min_node_pitch_[top]);
+      = std::min(min_node_pitch_.at(bottom), min_node_pitch_.at(top));
   const bool use_single_via = box->getBox().maxDXDY() < min_pitch_;
 
   if (single_via || use_single_via) {
@@ -650,23 +665,31 @@ void IRNetwork::generateCutLayerNodes()
     }
   }
 
-  std::vector<std::unique_ptr<Node>> loop_via_nodes;
-  std::vector<std::unique_ptr<Connection>> loop_via_connections;
-  for (odb::dbSBox* box : boxes) {
+  // Vias only read the database, so they are decoded in parallel and the
+  // results appended in box order.
+  std::vector<std::vector<std::unique_ptr<Node>>> box_nodes(boxes.size());
+  std::vector<std::vector<std::unique_ptr<Connection>>> box_connections(
+      boxes.size());
+#pragma omp parallel for num_threads(threads_) schedule(dynamic, 64)
+  for (std::size_t i = 0; i < boxes.size(); i++) {
     generateCutNodesForSBox(
-        box, use_single_via, loop_via_nodes, loop_via_connections);
+        boxes[i], use_single_via, box_nodes[i], box_connections[i]);
   }
   boxes.clear();
 
   LayerMap<std::vector<std::unique_ptr<Node>>> via_nodes;
-  for (auto& node : loop_via_nodes) {
-    via_nodes[node->getLayer()].push_back(std::move(node));
+  for (auto& nodes : box_nodes) {
+    for (auto& node : nodes) {
+      via_nodes[node->getLayer()].push_back(std::move(node));
+    }
   }
-  for (auto& connection : loop_via_connections) {
-    connections_.push_back(std::move(connection));
+  for (auto& connections : box_connections) {
+    for (auto& connection : connections) {
+      connections_.push_back(std::move(connection));
+    }
   }
-  loop_via_nodes.clear();
-  loop_via_connections.clear();
+  box_nodes.clear();
+  box_connections.clear();
 
   for (auto& [layer, nodes] : via_nodes) {
     // move vias to nodes_
@@ -687,8 +710,16 @@ void IRNetwork::generateTopLayerFillerNodes()
 
   const int max_distance = min_node_pitch_[top];
 
-  for (const auto& shape : shapes_[top]) {
-    for (auto& node : shape->createFillerNodes(max_distance, top_nodes)) {
+  const auto& top_shapes = shapes_[top];
+  std::vector<std::vector<std::unique_ptr<Node>>> shape_nodes(
+      top_shapes.size());
+#pragma omp parallel for num_threads(threads_) schedule(dynamic, 64)
+  for (std::size_t i = 0; i < top_shapes.size(); i++) {
+    shape_nodes[i] = top_shapes[i]->createFillerNodes(max_distance, top_nodes);
+  }
+
+  for (auto& nodes : shape_nodes) {
+    for (auto& node : nodes) {
       nodes_[node->getLayer()].push_back(std::move(node));
     }
   }
@@ -699,21 +730,32 @@ std::set<Node*> IRNetwork::getSharedShapeNodes() const
   const utl::DebugScopedTimer timer(
       logger_, utl::PSM, "timer", 1, "Build node -> shape count: {}");
 
-  std::set<Node*> shared_nodes;
+  std::vector<odb::dbTechLayer*> layers;
   for (const auto& [layer, nodes] : nodes_) {
-    const auto layer_shapes = getShapeTree(layer);
+    layers.push_back(layer);
+  }
 
-    for (const auto& node : nodes) {
+  std::vector<std::vector<Node*>> layer_shared(layers.size());
+#pragma omp parallel for num_threads(threads_) schedule(dynamic)
+  for (std::size_t i = 0; i < layers.size(); i++) {
+    const auto layer_shapes = getShapeTree(layers[i]);
+
+    for (const auto& node : nodes_.at(layers[i])) {
       const Point pt(node->getPoint().x(), node->getPoint().y());
       const auto shapes = std::distance(
           layer_shapes.qbegin(boost::geometry::index::intersects(pt)),
           layer_shapes.qend());
       if (shapes > 1) {
-        shared_nodes.insert(node.get());
+        layer_shared[i].push_back(node.get());
       }
     }
   }
 
+  std::set<Node*> shared_nodes;
+  for (const auto& nodes : layer_shared) {
+    shared_nodes.insert(nodes.begin(), nodes.end());
+  }
+
   return shared_nodes;
 }
 
@@ -1098,12 +1140,35 @@ void IRNetwork::connectLayerNodes()
 
   const std::size_t start_connections = connections_.size();
 
+  std::vector<odb::dbTechLayer*> layers;
+  std::vector<Shape*> shapes;
+  std::vector<std::size_t> shape_layer;
   for (const auto& [layer, layer_shapes] : shapes_) {
-    const auto layer_nodes = getNodeTree(layer);
     for (const auto& shape : layer_shapes) {
-      for (auto& conn : shape->connectNodes(layer_nodes)) {
-        connections_.push_back(std::move(conn));
-      }
+      shapes.push_back(shape.get());
+      shape_layer.push_back(layers.size());
+    }
+    layers.push_back(layer);
+  }
+
+  std::vector<NodeTree> layer_nodes(layers.size());
+#pragma omp parallel for num_threads(threads_) schedule(dynamic)
+  for (std::size_t i = 0; i < layers.size(); i++) {
+    layer_nodes[i] = getNodeTree(layers[i]);
+  }
+
+  // Shapes only create connections between their own nodes
+  std::vector<std::vector<std::unique_ptr<Connection>>> shape_connections(
+      shapes.size());
+#pragma omp parallel for num_threads(threads_) schedule(dynamic, 64)
+  for (std::size_t i = 0; i < shapes.size(); i++) {
+    shape_connections[i]
+        = shapes[i]->connectNodes(layer_nodes[shape_layer[i]]);
+  }
+
+  for (auto& connections : shape_connections) {
+    for (auto& conn : connections) {
+      connections_.push_back(std::move(conn));
     }
   }
 
@@ -90,7 +90,10 @@ class IRNetwork
   using Polygon90 = boost::polygon::polygon_90_with_holes_data<int>;
   using Polygon90Set = boost::polygon::polygon_90_set_data<int>;
 
-  IRNetwork(odb::dbNet* net, utl::Logger* logger, bool floorplanning);
+  IRNetwork(odb::dbNet* net,
+            utl::Logger* logger,
+            bool floorplanning,
+            int threads = 1);
 
   odb::dbNet* getNet() const { return net_; };
 
@@ -216,6 +219,8 @@ class IRNetwork
 
   bool floorplanning_;
 
+  int threads_;
+
   LayerMap<std::vector<std::unique_ptr<Shape>>> shapes_;
   LayerMap<std::vector<std::unique_ptr<Node>>> nodes_;
 
@@ -32,7 +32,9 @@
 
 #include "ir_solver.h"
 
-#include <Eigen/SparseLU>
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
 #include <fstream>
 #include <list>
 #include <queue>
@@ -44,6 +46,7 @@
 #include "odb/dbShape.h"
 #include "rsz/Resizer.hh"
 #include "shape.h"
+#include "sta/Clock.hh"
 #include "sta/Corner.hh"
 #include "sta/DcalcAnalysisPt.hh"
 #include "sta/Liberty.hh"
@@ -67,12 +70,13 @@ IRSolver::IRSolver(
     rsz::Resizer* resizer,
     utl::Logger* logger,
     const std::map<odb::dbNet*, std::map<sta::Corner*, Voltage>>& user_voltages,
-    const PDNSim::GeneratedSourceSettings& generated_source_settings)
+    const PDNSim::GeneratedSourceSettings& generated_source_settings,
+    int threads)
     : net_(net),
       logger_(logger),
       resizer_(resizer),
       sta_(sta),
-      network_(new IRNetwork(net_, logger_, floorplanning)),
+      network_(new IRNetwork(net_, logger_, floorplanning, threads)),
       gui_(nullptr),
       user_voltages_(user_voltages),
       generated_source_settings_(generated_source_settings)
@@ -740,6 +744,26 @@ void IRSolver::buildNodeCurrentMap(sta::Corner* corner,
   }
 }
 
+void IRSolver::buildNodeCapacitanceMap(
+    const PDNSim::TransientSettings& settings,
+    ValueNodeMap<Capacitance>& caps) const
+{
+  const utl::DebugScopedTimer timer(
+      logger_, utl::PSM, "timer", 1, "Build node/capacitance map: {}");
+
+  const double dbus = getBlock()->getDbUnitsPerMicron();
+  for (const auto& [inst, nodes] : network_->getInstanceNodeMapping()) {
+    odb::dbMaster* master = inst->getMaster();
+    const double width = master->getWidth() / dbus * 1e-6;
+    const double height = master->getHeight() / dbus * 1e-6;
+    const Capacitance cap = settings.cap_density * width * height;
+
+    for (auto* node : nodes) {
+      caps[node] += cap / nodes.size();
+    }
+  }
+}
+
 std::map<Node*, Connection::ConnectionSet> IRSolver::getNodeConnectionMap(
     const std::map<psm::Connection*, Connection::Conductance>& conductance)
     const
@@ -865,9 +889,550 @@ void IRSolver::addSourcesToMatrixAndVoltages(
   }
 }
 
+// FNV-1a over the corner, solver, loaded nodes and the structure and values
+// of G: the factorization only has to be redone when one of them changes.
+static std::size_t systemKey(
+    const SolverType solver_type,
+    const sta::Corner* corner,
+    const Eigen::SparseMatrix<Connection::Conductance>& G,
+    const std::vector<bool>& loaded)
+{
+  std::uint64_t hash = 0xcbf29ce484222325ULL;
+  auto add = [&hash](const void* data, const std::size_t size) {
+    const auto* bytes = static_cast<const unsigned char*>(data);
+    for (std::size_t i = 0; i < size; ++i) {
+      hash = (hash ^ bytes[i]) * 0x100000001b3ULL;
+    }
+  };
+  add(&solver_type, sizeof(solver_type));
+  add(&corner, sizeof(corner));
+  const Eigen::Index rows = G.rows();
+  add(&rows, sizeof(rows));
+  add(G.outerIndexPtr(), (G.outerSize() + 1) * sizeof(*G.outerIndexPtr()));
+  add(G.innerIndexPtr(), G.nonZeros() * sizeof(*G.innerIndexPtr()));
+  add(G.valuePtr(), G.nonZeros() * sizeof(*G.valuePtr()));
+  for (const bool load : loaded) {
+    add(&load, sizeof(load));
+  }
+  return hash;
+}
+
+// Kron reduction: nodes without a load or a source only pass current
+// between their neighbors, so they are eliminated exactly from G (Schur
+// complement) and their voltages recovered from their neighbors after the
+// solve.  Only nodes with few neighbors are eliminated, which keeps the
+// fill-in of the reduced matrix no larger than what is removed.  This
+// collapses the strap segments, rail chains and macro pin shapes that make
+// up most of the grid.
+void IRSolver::reduceMatrix(
+    const Eigen::SparseMatrix<Connection::Conductance>& G,
+    const std::vector<bool>& loaded,
+    const std::size_t num_real_nodes)
+{
+  using Matrix = Eigen::SparseMatrix<Connection::Conductance>;
+  using Neighbors
+      = std::vector<std::pair<Eigen::Index, Connection::Conductance>>;
+  const utl::DebugScopedTimer timer(
+      logger_, utl::PSM, "timer", 1, "Reduce G matrix: {}");
+
+  const Eigen::Index num_nodes = G.rows();
+  const Eigen::Index num_real = num_real_nodes;
+
+  std::vector<Connection::Conductance> diag(num_nodes, 0.0);
+  std::vector<Neighbors> neighbors(num_nodes);
+  std::vector<bool> keep = loaded;
+  for (Eigen::Index col = 0; col < num_nodes; ++col) {
+    for (Matrix::InnerIterator it(G, col); it; ++it) {
+      if (it.row() == col) {
+        diag[col] = it.value();
+      } else {
+        neighbors[col].emplace_back(it.row(), it.value());
+      }
+      if (col >= num_real) {
+        // sources and the nodes they attach to
+        keep[col] = true;
+        keep[it.row()] = true;
+      }
+    }
+  }
+  if (logger_->debugCheck(utl::PSM, "no_reduction", 1)
+      || logger_->debugCheck(utl::PSM, "dump", 1)) {
+    // keep the full system so dumped node ids match the matrix
+    keep.assign(num_nodes, true);
+  }
+
+  auto add_conductance = [&neighbors](const Eigen::Index node,
+                                      const Eigen::Index other,
+                                      const Connection::Conductance value) {
+    for (auto& [neighbor, cond] : neighbors[node]) {
+      if (neighbor == other) {
+        cond += value;
+        return;
+      }
+    }
+    neighbors[node].emplace_back(other, value);
+  };
+
+  Reduction& reduction = factorization_->reduction;
+  reduction.eliminated_start.push_back(0);
+  std::vector<bool> eliminated(num_nodes, false);
+  bool changed = true;
+  while (changed) {
+    changed = false;
+    for (Eigen::Index node = 0; node < num_real; ++node) {
+      const Neighbors& node_neighbors = neighbors[node];
+      if (keep[node] || eliminated[node]
+          || node_neighbors.size() > max_reduction_degree_
+          || diag[node] <= 0.0) {
+        continue;
+      }
+
+      const Connection::Conductance node_diag = diag[node];
+      for (const auto& [other, cond] : node_neighbors) {
+        auto& other_neighbors = neighbors[other];
+        other_neighbors.erase(
+            std::find_if(other_neighbors.begin(),
+                         other_neighbors.end(),
+                         [node](const auto& n) { return n.first == node; }));
+        diag[other] -= cond * cond / node_diag;
+        for (const auto& [fill, fill_cond] : node_neighbors) {
+          if (fill != other) {
+            add_conductance(other, fill, -cond * fill_cond / node_diag);
+          }
+        }
+      }
+
+      eliminated[node] = true;
+      reduction.eliminated.push_back(node);
+      reduction.eliminated_diag.push_back(node_diag);
+      for (const auto& [other, cond] : node_neighbors) {
+        reduction.eliminated_nodes.push_back(other);
+        reduction.eliminated_values.push_back(cond);
+      }
+      reduction.eliminated_start.push_back(reduction.eliminated_nodes.size());
+      Neighbors().swap(neighbors[node]);
+      changed = true;
+    }
+  }
+
+  std::vector<Eigen::Index> reduced_index(num_nodes, -1);
+  Eigen::Index num_real_kept = 0;
+  for (Eigen::Index node = 0; node < num_nodes; ++node) {
+    if (!eliminated[node]) {
+      reduced_index[node] = reduction.kept.size();
+      reduction.kept.push_back(node);
+      if (node < num_real) {
+        num_real_kept++;
+      }
+    }
+  }
+  reduction.num_real_kept = num_real_kept;
+
+  std::vector<Eigen::Triplet<Connection::Conductance>> values;
+  for (const Eigen::Index node : reduction.kept) {
+    const Eigen::Index idx = reduced_index[node];
+    if (diag[node] != 0.0) {
+      values.emplace_back(idx, idx, diag[node]);
+    }
+    for (const auto& [other, cond] : neighbors[node]) {
+      values.emplace_back(reduced_index[other], idx, cond);
+    }
+  }
+  Matrix& reduced = factorization_->reduced;
+  reduced.resize(reduction.kept.size(), reduction.kept.size());
+  reduced.setFromTriplets(values.begin(), values.end());
+  reduced.makeCompressed();
+
+  debugPrint(logger_,
+             utl::PSM,
+             "solve",
+             1,
+             "Reduced G matrix from {} to {} nodes ({} to {} non-zeros)",
+             num_nodes,
+             reduced.rows(),
+             G.nonZeros(),
+             reduced.nonZeros());
+}
+
+Eigen::VectorXd IRSolver::reduceVector(const Eigen::VectorXd& J) const
+{
+  const auto& kept = factorization_->reduction.kept;
+  Eigen::VectorXd reduced(kept.size());
+  for (std::size_t i = 0; i < kept.size(); ++i) {
+    reduced[i] = J[kept[i]];
+  }
+  return reduced;
+}
+
+Eigen::VectorXd IRSolver::expandSolution(const Eigen::VectorXd& V) const
+{
+  const Reduction& reduction = factorization_->reduction;
+
+  Eigen::VectorXd full = Eigen::VectorXd::Zero(factorization_->num_nodes);
+  for (std::size_t i = 0; i < reduction.kept.size(); ++i) {
+    full[reduction.kept[i]] = V[i];
+  }
+
+  // Restore in reverse order so every neighbor is solved before the node
+  for (std::size_t i = reduction.eliminated.size(); i-- > 0;) {
+    Voltage sum = 0.0;
+    for (std::size_t n = reduction.eliminated_start[i];
+         n < reduction.eliminated_start[i + 1];
+         ++n) {
+      sum -= reduction.eliminated_values[n]
+             * full[reduction.eliminated_nodes[n]];
+    }
+    full[reduction.eliminated[i]] = sum / reduction.eliminated_diag[i];
+  }
+
+  return full;
+}
+
+void IRSolver::factorizeLU(const std::map<Node*, std::size_t>& node_index)
+{
+  const auto& G = factorization_->reduced;
+  auto& lu = factorization_->lu;
+  lu = std::make_unique<
+      Eigen::SparseLU<Eigen::SparseMatrix<Connection::Conductance>>>();
+
+  debugPrint(logger_, utl::PSM, "solve", 1, "Factorizing the G matrix");
+  lu->compute(G);
+  if (lu->info() != Eigen::ComputationInfo::Success) {
+    // decomposition failed
+    if (logger_->debugCheck(utl::PSM, "dump", 1)) {
+      network_->dumpNodes(node_index);
+      dumpMatrix(G, "G");
+    }
+    logger_->error(
+        utl::PSM,
+        10,
+        "LU factorization of the G Matrix failed. SparseLU solver message: {}.",
+        lu->lastErrorMessage());
+  }
+}
+
+Eigen::VectorXd IRSolver::solveLU(
+    const Eigen::VectorXd& J,
+    const std::map<Node*, std::size_t>& node_index) const
+{
+  const auto& G = factorization_->reduced;
+
+  debugPrint(logger_, utl::PSM, "solve", 1, "Solving system of equations GV=J");
+  Eigen::VectorXd V = factorization_->lu->solve(J);
+  if (factorization_->lu->info() != Eigen::ComputationInfo::Success) {
+    // solving failed
+    if (logger_->debugCheck(utl::PSM, "dump", 1)) {
+      network_->dumpNodes(node_index);
+      dumpMatrix(G, "G");
+      dumpVector(J, "J");
+    }
+    logger_->error(utl::PSM, 12, "Solving V = inv(G)*J failed.");
+  }
+  debugPrint(logger_,
+             utl::PSM,
+             "solve",
+             1,
+             "Solving system of equations GV=J complete");
+
+  return V;
+}
+
+// Conjugate gradient treats the source nodes as fixed voltages rather than
+// using the extra rows added by addSourcesToMatrixAndVoltages: the
+// conductance matrix of the remaining free nodes is symmetric positive
+// definite.
+void IRSolver::factorizeCG(const std::size_t num_real_nodes)
+{
+  using Matrix = Eigen::SparseMatrix<Connection::Conductance>;
+  const Matrix& G = factorization_->reduced;
+  const Eigen::Index num_real = num_real_nodes;
+
+  // Source rows hold a single entry tying their node to the source voltage.
+  auto& free_index = factorization_->free_index;
+  auto& fixed_sources = factorization_->fixed_sources;
+  free_index.assign(num_real, 0);
+  for (Eigen::Index col = 0; col < num_real; ++col) {
+    for (Matrix::InnerIterator it(G, col); it; ++it) {
+      if (it.row() >= num_real) {
+        free_index[col] = -1;
+        fixed_sources.emplace_back(col, it.row(), it.value());
+      }
+    }
+  }
+  Eigen::Index num_free = 0;
+  for (Eigen::Index& index : free_index) {
+    if (index == 0) {
+      index = num_free++;
+    }
+  }
+
+  std::vector<Eigen::Triplet<Connection::Conductance>> values;
+  values.reserve(G.nonZeros());
+  auto& fixed_coupling = factorization_->fixed_coupling;
+  for (Eigen::Index col = 0; col < num_real; ++col) {
+    for (Matrix::InnerIterator it(G, col); it; ++it) {
+      if (it.row() >= num_real || free_index[it.row()] < 0) {
+        continue;
+      }
+      if (free_index[col] >= 0) {
+        values.emplace_back(
+            free_index[it.row()], free_index[col], it.value());
+      } else {
+        fixed_coupling.emplace_back(free_index[it.row()], col, it.value());
+      }
+    }
+  }
+  Matrix& A = factorization_->A;
+  A.resize(num_free, num_free);
+  A.setFromTriplets(values.begin(), values.end());
+  values.clear();
+
+  debugPrint(logger_,
+             utl::PSM,
+             "solve",
+             1,
+             "Conjugate gradient on {} free nodes, {} fixed nodes",
+             num_free,
+             num_real - num_free);
+
+  auto& cg = factorization_->cg;
+  cg = std::make_unique<Eigen::ConjugateGradient<
+      Matrix,
+      Eigen::Lower | Eigen::Upper,
+      Eigen::IncompleteCholesky<Connection::Conductance>>>();
+  cg->setTolerance(cg_tolerance_);
+  cg->compute(A);
+  if (cg->info() != Eigen::ComputationInfo::Success) {
+    logger_->error(utl::PSM,
+                   94,
+                   "Incomplete Cholesky factorization of the G matrix failed.");
+  }
+}
+
+// Entries past num_real_nodes in the result are left at zero.
+Eigen::VectorXd IRSolver::solveCG(const Eigen::VectorXd& J,
+                                  const std::size_t num_real_nodes,
+                                  const int threads,
+                                  const bool report) const
+{
+  const utl::DebugScopedTimer timer(
+      logger_, utl::PSM, "timer", 1, "Conjugate gradient: {}");
+
+  const auto& free_index = factorization_->free_index;
+  const Eigen::Index num_real = num_real_nodes;
+  const Eigen::Index num_free = factorization_->A.rows();
+
+  std::vector<Voltage> fixed(num_real, 0.0);
+  for (const auto& [node, source, cond] : factorization_->fixed_sources) {
+    fixed[node] = J[source] / cond;
+  }
+
+  Eigen::VectorXd b(num_free);
+  Voltage fixed_sum = 0.0;
+  for (Eigen::Index i = 0; i < num_real; ++i) {
+    if (free_index[i] >= 0) {
+      b[free_index[i]] = J[i];
+    } else {
+      fixed_sum += fixed[i];
+    }
+  }
+  for (const auto& coupling : factorization_->fixed_coupling) {
+    b[coupling.row()] -= coupling.value() * fixed[coupling.col()];
+  }
+
+  // The nodes sit close to the source voltage, which makes a good guess.
+  const Eigen::Index fixed_count = num_real - num_free;
+  const Voltage guess = fixed_count > 0 ? fixed_sum / fixed_count : 0.0;
+
+  // Eigen's thread count is process wide, so give it back afterwards.
+  const int prev_threads = Eigen::nbThreads();
+  Eigen::setNbThreads(threads);
+  const auto& cg = factorization_->cg;
+  const Eigen::VectorXd x
+      = cg->solveWithGuess(b, Eigen::VectorXd::Constant(num_free, guess));
+  Eigen::setNbThreads(prev_threads);
+  if (cg->info() != Eigen::ComputationInfo::Success) {
+    logger_->error(utl::PSM,
+                   95,
+                   "Conjugate gradient did not converge after {} iterations "
+                   "(relative residual {:.3e}).",
+                   cg->iterations(),
+                   cg->error());
+  }
+  if (report) {
+    logger_->info(utl::PSM,
+                  96,
+                  "Conjugate gradient converged after {} iterations (relative "
+                  "residual {:.3e}).",
+                  cg->iterations(),
+                  cg->error());
+  }
+
+  Eigen::VectorXd V = Eigen::VectorXd::Zero(J.size());
+  for (Eigen::Index i = 0; i < num_real; ++i) {
+    V[i] = free_index[i] >= 0 ? x[free_index[i]] : fixed[i];
+  }
+  return V;
+}
+
+void IRSolver::factorize(const SolverType solver_type,
+                         sta::Corner* corner,
+                         Eigen::SparseMatrix<Connection::Conductance>&& G,
+                         std::vector<bool>&& loaded,
+                         const std::size_t num_real_nodes,
+                         const std::map<Node*, std::size_t>& node_index)
+{
+  // G only depends on the network, the corner's resistances and the source
+  // locations, so repeated analyses with new currents skip factorization.
+  const std::size_t key = systemKey(solver_type, corner, G, loaded);
+  if (factorization_ != nullptr && factorization_->key == key) {
+    debugPrint(logger_, utl::PSM, "solve", 1, "Reusing the G factorization");
+    return;
+  }
+
+  factorization_ = std::make_unique<Factorization>();
+  factorization_->type = solver_type;
+  factorization_->key = key;
+  factorization_->num_nodes = G.rows();
+  reduceMatrix(G, loaded, num_real_nodes);
+  if (solver_type == SolverType::CG) {
+    factorizeCG(factorization_->reduction.num_real_kept);
+  } else {
+    factorizeLU(node_index);
+  }
+  if (logger_->debugCheck(utl::PSM, "dump", 1)) {
+    factorization_->G = std::move(G);
+  } else {
+    factorization_->reduced = Eigen::SparseMatrix<Connection::Conductance>();
+  }
+}
+
+Eigen::VectorXd IRSolver::solveFactorized(
+    const Eigen::VectorXd& J,
+    const std::map<Node*, std::size_t>& node_index,
+    const int threads,
+    const bool report) const
+{
+  const Eigen::VectorXd J_reduced = reduceVector(J);
+  return expandSolution(
+      factorization_->type == SolverType::CG
+          ? solveCG(J_reduced,
+                    factorization_->reduction.num_real_kept,
+                    threads,
+                    report)
+          : solveLU(J_reduced, node_index));
+}
+
+// Backward Euler on (G + C/h) V(t+h) = J(t+h) + C/h V(t), starting from the
+// unloaded grid.  Every cell draws its average current as a triangular pulse
+// over the first half of each period of the fastest clock, and its intrinsic
+// capacitance is taken from its area.  The worst voltage of every node over
+// two clock periods is returned.
+Eigen::VectorXd IRSolver::solveTransient(
+    const PDNSim::TransientSettings& settings,
+    const Voltage src_voltage,
+    const std::map<Node*, std::size_t>& real_node_index,
+    const std::map<Node*, std::size_t>& node_index,
+    Eigen::SparseMatrix<Connection::Conductance>&& G,
+    const Eigen::VectorXd& J,
+    std::vector<bool>&& loaded,
+    const SolverType solver_type,
+    sta::Corner* corner,
+    const int threads)
+{
+  const utl::DebugScopedTimer timer(
+      logger_, utl::PSM, "timer", 1, "Transient analysis: {}");
+
+  float period = 0.0;
+  for (sta::Clock* clk : *sta_->sdc()->clocks()) {
+    if (clk->period() > 0.0 && (period == 0.0 || clk->period() < period)) {
+      period = clk->period();
+    }
+  }
+  if (period == 0.0) {
+    logger_->error(
+        utl::PSM,
+        97,
+        "Transient analysis requires a clock to define the switching period.");
+  }
+
+  const double time_step
+      = settings.time_step > 0.0 ? settings.time_step : period / 20;
+  constexpr int cycles = 2;
+  const int steps = std::ceil(cycles * period / time_step);
+  logger_->info(utl::PSM,
+                98,
+                "Transient analysis of {} steps of {:.3e} s over {} clock "
+                "periods of {:.3e} s.",
+                steps,
+                time_step,
+                cycles,
+                period);
+
+  const Eigen::Index num_nodes = G.rows();
+  const Eigen::Index num_real = real_node_index.size();
+
+  ValueNodeMap<Capacitance> caps;
+  buildNodeCapacitanceMap(settings, caps);
+  Eigen::VectorXd cap_step = Eigen::VectorXd::Zero(num_nodes);
+  for (const auto& [node, idx] : real_node_index) {
+    auto find_node = caps.find(node);
+    if (find_node == caps.end()) {
+      continue;
+    }
+    cap_step[idx] = find_node->second / time_step;
+    G.coeffRef(idx, idx) += cap_step[idx];
+    // keep the node through the reduction, it stores charge
+    loaded[idx] = true;
+  }
+
+  factorize(solver_type,
+            corner,
+            std::move(G),
+            std::move(loaded),
+            num_real,
+            node_index);
+
+  auto waveform = [period](const double time) {
+    const double phase = std::fmod(time, period) / period;
+    if (phase < 0.25) {
+      return 16 * phase;
+    }
+    if (phase < 0.5) {
+      return 16 * (0.5 - phase);
+    }
+    return 0.0;
+  };
+
+  const bool is_ground = src_voltage == 0.0;
+  Eigen::VectorXd V = Eigen::VectorXd::Constant(num_nodes, src_voltage);
+  Eigen::VectorXd worst = V;
+  Eigen::VectorXd J_step = J;
+  for (int step = 1; step <= steps; step++) {
+    const double scale = waveform(step * time_step);
+#pragma omp parallel for num_threads(threads) schedule(static)
+    for (Eigen::Index i = 0; i < num_real; i++) {
+      J_step[i] = scale * J[i] + cap_step[i] * V[i];
+    }
+
+    V = solveFactorized(J_step, node_index, threads, false);
+
+#pragma omp parallel for num_threads(threads) schedule(static)
+    for (Eigen::Index i = 0; i < num_real; i++) {
+      worst[i]
+          = is_ground ? std::max(worst[i], V[i]) : std::min(worst[i], V[i]);
+    }
+  }
+
+  return worst;
+}
+
 void IRSolver::solve(sta::Corner* corner,
                      GeneratedSourceType source_type,
-                     const std::string& source_file)
+                     const std::string& source_file,
+                     const SolverType solver_type,
+                     const int threads,
+                     const PDNSim::TransientSettings* transient)
 {
   const utl::DebugScopedTimer timer(logger_, utl::PSM, "timer", 1, "Solve: {}");
 
@@ -939,44 +1504,39 @@ void IRSolver::solve(sta::Corner* corner,
                              G,
                              J);
   addSourcesToMatrixAndVoltages(src_voltage, src_nodes, node_index, G, J);
+  G.makeCompressed();
 
-  Eigen::SparseLU<Eigen::SparseMatrix<Connection::Conductance>> eigen_solver;
-
-  debugPrint(logger_, utl::PSM, "solve", 1, "Factorizing the G matrix");
-  eigen_solver.compute(G);
-  if (eigen_solver.info() != Eigen::ComputationInfo::Success) {
-    // decomposition failed
-    if (logger_->debugCheck(utl::PSM, "dump", 1)) {
-      network_->dumpNodes(node_index);
-      dumpMatrix(G, "G");
-    }
-    logger_->error(
-        utl::PSM,
-        10,
-        "LU factorization of the G Matrix failed. SparseLU solver message: {}.",
-        eigen_solver.lastErrorMessage());
-  }
-
-  debugPrint(logger_, utl::PSM, "solve", 1, "Solving system of equations GV=J");
-  const Eigen::VectorXd V = eigen_solver.solve(J);
-  if (eigen_solver.info() != Eigen::ComputationInfo::Success) {
-    // solving failed
-    if (logger_->debugCheck(utl::PSM, "dump", 1)) {
-      network_->dumpNodes(node_index);
-      dumpMatrix(G, "G");
-      dumpVector(J, "J");
-    }
-    logger_->error(utl::PSM, 12, "Solving V = inv(G)*J failed.");
+  // Nodes that can draw current
+  std::vector<bool> loaded(num_nodes, false);
+  for (const auto& [node, node_idx] : real_node_index) {
+    loaded[node_idx] = currents.find(node) != currents.end();
+  }
+
+  Eigen::VectorXd V;
+  if (transient != nullptr) {
+    V = solveTransient(*transient,
+                       src_voltage,
+                       real_node_index,
+                       node_index,
+                       std::move(G),
+                       J,
+                       std::move(loaded),
+                       solver_type,
+                       corner,
+                       threads);
+  } else {
+    factorize(solver_type,
+              corner,
+              std::move(G),
+              std::move(loaded),
+              real_node_index.size(),
+              node_index);
+    V = solveFactorized(J, node_index, threads);
   }
-  debugPrint(logger_,
-             utl::PSM,
-             "solve",
-             1,
-             "Solving system of equations GV=J complete");
 
   if (logger_->debugCheck(utl::PSM, "dump", 2)) {
     network_->dumpNodes(node_index);
-    dumpMatrix(G, "G");
+    dumpMatrix(factorization_->G, "G");
     dumpVector(J, "J");
     dumpVector(V, "V");
   }
@@ -33,11 +33,13 @@
 #pragma once
 
 #include <Eigen/Sparse>
+#include <Eigen/SparseLU>
 #include <boost/geometry.hpp>
 #include <boost/polygon/polygon.hpp>
 #include <map>
 #include <memory>
 #include <optional>
+#include <tuple>
 #include <vector>
 
 #include "debug_gui.h"
@@ -65,6 +67,7 @@ class IRSolver
   using Voltage = double;
   using Current = double;
   using Power = float;
+  using Capacitance = double;
 
   struct Results
   {
@@ -94,7 +97,8 @@ class IRSolver
            utl::Logger* logger,
            const std::map<odb::dbNet*, std::map<sta::Corner*, Voltage>>&
                user_voltages,
-           const PDNSim::GeneratedSourceSettings& generated_source_settings);
+           const PDNSim::GeneratedSourceSettings& generated_source_settings,
+           int threads = 1);
 
   odb::dbNet* getNet() const { return net_; };
 
@@ -102,7 +106,10 @@ class IRSolver
 
   void solve(sta::Corner* corner,
              GeneratedSourceType source_type,
-             const std::string& source_file);
+             const std::string& source_file,
+             SolverType solver_type = SolverType::LU,
+             int threads = 1,
+             const PDNSim::TransientSettings* transient = nullptr);
 
   void report(sta::Corner* corner) const;
   void reportEM(sta::Corner* corner) const;
@@ -192,6 +199,8 @@ class IRSolver
       const;
   void buildNodeCurrentMap(sta::Corner* corner,
                            ValueNodeMap<Current>& currents) const;
+  void buildNodeCapacitanceMap(const PDNSim::TransientSettings& settings,
+                               ValueNodeMap<Capacitance>& caps) const;
   std::map<Node*, std::size_t> assignNodeIDs(const Node::NodeSet& nodes,
                                              std::size_t start = 0) const;
   std::map<Node*, std::size_t> assignNodeIDs(
@@ -212,6 +221,43 @@ class IRSolver
       Eigen::SparseMatrix<Connection::Conductance>& G,
       Eigen::VectorXd& J) const;
 
+  void reduceMatrix(const Eigen::SparseMatrix<Connection::Conductance>& G,
+                    const std::vector<bool>& loaded,
+                    std::size_t num_real_nodes);
+  Eigen::VectorXd reduceVector(const Eigen::VectorXd& J) const;
+  Eigen::VectorXd expandSolution(const Eigen::VectorXd& V) const;
+  void factorizeLU(const std::map<Node*, std::size_t>& node_index);
+  Eigen::VectorXd solveLU(
+      const Eigen::VectorXd& J,
+      const std::map<Node*, std::size_t>& node_index) const;
+  void factorizeCG(std::size_t num_real_nodes);
+  Eigen::VectorXd solveCG(const Eigen::VectorXd& J,
+                          std::size_t num_real_nodes,
+                          int threads,
+                          bool report = true) const;
+  void factorize(SolverType solver_type,
+                 sta::Corner* corner,
+                 Eigen::SparseMatrix<Connection::Conductance>&& G,
+                 std::vector<bool>&& loaded,
+                 std::size_t num_real_nodes,
+                 const std::map<Node*, std::size_t>& node_index);
+  Eigen::VectorXd solveFactorized(
+      const Eigen::VectorXd& J,
+      const std::map<Node*, std::size_t>& node_index,
+      int threads,
+      bool report = true) const;
+  Eigen::VectorXd solveTransient(
+      const PDNSim::TransientSettings& settings,
+      Voltage src_voltage,
+      const std::map<Node*, std::size_t>& real_node_index,
+      const std::map<Node*, std::size_t>& node_index,
+      Eigen::SparseMatrix<Connection::Conductance>&& G,
+      const Eigen::VectorXd& J,
+      std::vector<bool>&& loaded,
+      SolverType solver_type,
+      sta::Corner* corner,
+      int threads);
+
   std::string getMetricKey(const std::string& key, sta::Corner* corner) const;
 
   void dumpVector(const Eigen::VectorXd& vector, const std::string& name) const;
@@ -240,10 +286,58 @@ class IRSolver
   std::set<const Node*> visited_;
   std::optional<bool> connected_;
 
+  // G rows removed by Kron reduction, in elimination order, with the
+  // neighbors and conductances they had when eliminated.
+  struct Reduction
+  {
+    std::vector<Eigen::Index> kept;  // reduced index -> G index
+    Eigen::Index num_real_kept = 0;
+    std::vector<Eigen::Index> eliminated;
+    std::vector<Connection::Conductance> eliminated_diag;
+    std::vector<std::size_t> eliminated_start;
+    std::vector<Eigen::Index> eliminated_nodes;
+    std::vector<Connection::Conductance> eliminated_values;
+  };
+
+  // Factorization of the last G matrix solved.  Only what later solves
+  // need is kept: G and the reduced matrix are dropped once factorized
+  // unless they are dumped.
+  struct Factorization
+  {
+    SolverType type;
+    // Hash of the corner, solver, loaded nodes and G the factors are for.
+    std::size_t key = 0;
+    Eigen::Index num_nodes = 0;
+    Eigen::SparseMatrix<Connection::Conductance> G;
+    Reduction reduction;
+    Eigen::SparseMatrix<Connection::Conductance> reduced;
+    std::unique_ptr<
+        Eigen::SparseLU<Eigen::SparseMatrix<Connection::Conductance>>>
+        lu;
+    // Conjugate gradient works on the free (non-source) nodes only.
+    std::vector<Eigen::Index> free_index;  // -1 for source nodes
+    // Source nodes with the row and conductance of the source fixing them,
+    // and the conductances between free and source nodes.
+    std::vector<std::tuple<Eigen::Index, Eigen::Index, Connection::Conductance>>
+        fixed_sources;
+    std::vector<Eigen::Triplet<Connection::Conductance>> fixed_coupling;
+    // The conjugate gradient solver refers to A rather than copying it.
+    Eigen::SparseMatrix<Connection::Conductance> A;
+    std::unique_ptr<Eigen::ConjugateGradient<
+        Eigen::SparseMatrix<Connection::Conductance>,
+        Eigen::Lower | Eigen::Upper,
+        Eigen::IncompleteCholesky<Connection::Conductance>>>
+        cg;
+  };
+  std::unique_ptr<Factorization> factorization_;
+
   std::map<sta::Corner*, ValueNodeMap<Voltage>> voltages_;
   std::map<sta::Corner*, ValueNodeMap<Current>> currents_;
 
   static constexpr Current spice_file_min_current_ = 1e-18;
+  // Relative residual |G*V - J| / |J| at which conjugate gradient stops.
+  static constexpr double cg_tolerance_ = 1e-10;
+  static constexpr std::size_t max_reduction_degree_ = 3;
 };
 
 }  // namespace psm
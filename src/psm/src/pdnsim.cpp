@@ -96,14 +96,22 @@ void PDNSim::analyzePowerGrid(odb::dbNet* net,
                               bool enable_em,
                               const std::string& em_file,
                               const std::string& error_file,
-                              const std::string& voltage_source_file)
+                              const std::string& voltage_source_file,
+                              SolverType solver_type,
+                              int threads,
+                              const TransientSettings* transient)
 {
   if (!checkConnectivity(net, false, error_file)) {
     return;
   }
 
   auto* solver = getIRSolver(net, false);
-  solver->solve(corner, source_type, voltage_source_file);
+  solver->solve(corner,
+                source_type,
+                voltage_source_file,
+                solver_type,
+                threads,
+                transient);
   solver->report(corner);
 
   heatmap_->setNet(net);
@@ -164,7 +172,8 @@ psm::IRSolver* PDNSim::getIRSolver(odb::dbNet* net, bool floorplanning)
                                         resizer_,
                                         logger_,
                                         user_voltages_,
-                                        generated_source_settings_);
+                                        generated_source_settings_,
+                                        threads_);
     addOwner(net->getBlock());
   }
 
@@ -67,6 +67,17 @@ using sta::Corner;
   }
 }
 
+%typemap(in) psm::SolverType {
+  int length;
+  const char *arg = Tcl_GetStringFromObj($input, &length);
+
+  if (strcmp(arg, "CG") == 0) {
+    $1 = psm::SolverType::CG;
+  } else {
+    $1 = psm::SolverType::LU;
+  }
+}
+
 %inline %{
 
 
@@ -78,16 +89,24 @@ set_net_voltage_cmd(odb::dbNet* net, Corner* corner, double voltage)
 }
 
 void 
-analyze_power_grid_cmd(odb::dbNet* net, Corner* corner, psm::GeneratedSourceType type, const char* error_file, bool enable_em, const char* em_file, const char* voltage_file, const char* voltage_source_file)
+analyze_power_grid_cmd(odb::dbNet* net, Corner* corner, psm::GeneratedSourceType type, const char* error_file, bool enable_em, const char* em_file, const char* voltage_file, const char* voltage_source_file, psm::SolverType solver_type, bool transient, double time_step, double cap_density)
 {
   PDNSim* pdnsim = getPDNSim();
-  pdnsim->analyzePowerGrid(net, corner, type, voltage_file, enable_em, em_file, error_file, voltage_source_file);
+  const int threads = ord::OpenRoad::openRoad()->getThreadCount();
+  PDNSim::TransientSettings transient_settings;
+  transient_settings.time_step = time_step;
+  if (cap_density >= 0) {
+    transient_settings.cap_density = cap_density;
+  }
+  pdnsim->setThreadCount(threads);
+  pdnsim->analyzePowerGrid(net, corner, type, voltage_file, enable_em, em_file, error_file, voltage_source_file, solver_type, threads, transient ? &transient_settings : nullptr);
 }
 
 bool
 check_connectivity_cmd(odb::dbNet* net, bool floorplanning, const char* error_file)
 {
   PDNSim* pdnsim = getPDNSim();
+  pdnsim->setThreadCount(ord::OpenRoad::openRoad()->getThreadCount());
   return pdnsim->checkConnectivity(net, floorplanning, error_file);
 }
 
@@ -95,6 +114,7 @@ void
 write_spice_file_cmd(odb::dbNet* net, Corner* corner, psm::GeneratedSourceType type, const char* file, const char* voltage_source_file)
 {
   PDNSim* pdnsim = getPDNSim();
+  pdnsim->setThreadCount(ord::OpenRoad::openRoad()->getThreadCount());
   return pdnsim->writeSpiceNetwork(net, corner, type, file, voltage_source_file);
 }
 
@@ -66,13 +66,17 @@ sta::define_cmd_args "analyze_power_grid" {
   [-em_outfile em_file]
   [-vsrc voltage_source_file]
   [-source_type FULL|BUMPS|STRAPS]
+  [-solver LU|CG]
+  [-transient]
+  [-time_step time_step]
+  [-cap_density cap_density]
 }
 
 proc analyze_power_grid { args } {
   sta::parse_key_args "analyze_power_grid" args \
     keys {-net -corner -voltage_file -error_file -em_outfile -vsrc \
-      -source_type} \
-    flags {-enable_em}
+      -source_type -solver -time_step -cap_density} \
+    flags {-enable_em -transient}
   if { ![info exists keys(-net)] } {
     utl::error PSM 58 "Argument -net not specified."
   }
@@ -97,6 +101,35 @@ proc analyze_power_grid { args } {
     set source_type $keys(-source_type)
   }
 
+  set solver "LU"
+  if { [info exists keys(-solver)] } {
+    set solver $keys(-solver)
+    if { [lsearch -exact {LU CG} $solver] == -1 } {
+      utl::error PSM 93 "-solver must be LU or CG."
+    }
+  }
+
+  set transient [info exists flags(-transient)]
+  set time_step 0.0
+  if { [info exists keys(-time_step)] } {
+    set time_step $keys(-time_step)
+    sta::check_positive_float "-time_step" $time_step
+    set time_step [sta::time_ui_sta $time_step]
+  }
+  set cap_density -1.0
+  if { [info exists keys(-cap_density)] } {
+    set cap_density $keys(-cap_density)
+    sta::check_positive_float "-cap_density" $cap_density
+    set dist [sta::distance_ui_sta 1.0]
+    set cap_density \
+      [expr [sta::capacitance_ui_sta $cap_density] / ($dist * $dist)]
+  }
+  if { !$transient
+       && ([info exists keys(-time_step)]
+           || [info exists keys(-cap_density)]) } {
+    utl::error PSM 99 "-time_step and -cap_density require -transient."
+  }
+
   set enable_em [info exists flags(-enable_em)]
   set em_file ""
   if { [info exists keys(-em_outfile)]} {
@@ -114,7 +147,11 @@ proc analyze_power_grid { args } {
     $enable_em \
     $em_file \
     $voltage_file \
-    $voltage_source_file
+    $voltage_source_file \
+    $solver \
+    $transient \
+    $time_step \
+    $cap_density
 }
 
 sta::define_cmd_args "write_pg_spice" {
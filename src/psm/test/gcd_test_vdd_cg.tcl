@@ -0,0 +1,11 @@
+source helpers.tcl
+
+read_lef Nangate45/Nangate45.lef
+read_def Nangate45_data/gcd.def
+read_liberty Nangate45/Nangate45_typ.lib
+read_sdc Nangate45_data/gcd.sdc
+
+# The iteration count depends on the Eigen version.
+suppress_message PSM 96
+
+analyze_power_grid -vsrc Vsrc_gcd_vdd.loc -net VDD -solver CG
@@ -0,0 +1,62 @@
+# analyze_power_grid -transient checks on the gcd VDD grid.
+source helpers.tcl
+
+read_lef Nangate45/Nangate45.lef
+read_def Nangate45_data/gcd.def
+read_liberty Nangate45/Nangate45_typ.lib
+read_sdc Nangate45_data/gcd.sdc
+
+# Return the voltages of a voltage file keyed by instance.
+proc read_voltages { file } {
+  set voltages {}
+  set stream [open $file r]
+  gets $stream
+  while { [gets $stream line] >= 0 } {
+    set fields [split $line ","]
+    dict set voltages [lindex $fields 0] [lindex $fields end]
+  }
+  close $stream
+  return $voltages
+}
+
+proc worst_drop { voltages supply } {
+  set drop 0.0
+  dict for {inst voltage} $voltages {
+    if { $voltage <= 0.0 || $voltage > $supply + 1e-6 } {
+      puts "fail - $inst at $voltage V"
+      exit 1
+    }
+    set drop [expr max($drop, $supply - $voltage)]
+  }
+  return $drop
+}
+
+if { ![catch {analyze_power_grid -vsrc Vsrc_gcd_vdd.loc -net VDD \
+                -cap_density 10}] } {
+  puts "fail - -cap_density accepted without -transient"
+  exit 1
+}
+
+set supply 1.1
+
+set voltage_file [make_result_file gcd_transient-voltage.rpt]
+analyze_power_grid -vsrc Vsrc_gcd_vdd.loc -net VDD -transient \
+  -voltage_file $voltage_file
+set drop [worst_drop [read_voltages $voltage_file] $supply]
+if { $drop <= 0.0 } {
+  puts "fail - no transient drop"
+  exit 1
+}
+
+# Decoupling by a huge intrinsic capacitance holds the grid near the supply.
+set decap_file [make_result_file gcd_transient_decap-voltage.rpt]
+analyze_power_grid -vsrc Vsrc_gcd_vdd.loc -net VDD -transient \
+  -cap_density 1e6 -voltage_file $decap_file
+set decap_drop [worst_drop [read_voltages $decap_file] $supply]
+if { $decap_drop >= $drop } {
+  puts "fail - decap drop $decap_drop not below $drop"
+  exit 1
+}
+
+puts "pass"
+exit
@@ -37,6 +37,7 @@
 #include "ext2dBox.h"
 #include "extprocess.h"
 #include "odb/db.h"
+#include "odb/dbBlockCallBackObj.h"
 #include "odb/dbExtControl.h"
 #include "odb/dbShape.h"
 #include "odb/odb.h"
@@ -1230,6 +1231,33 @@ class extCorner
   extCorner* _extCornerPtr;
 };
 
+// Flags the nets whose wires are edited after extraction (dbNet's
+// wireAltered) so that incremental extraction can find them.  Removed
+// wires also flag their net, whose stale parasitics must go, and are
+// remembered by area as their coupling neighbors must be extracted again.
+class extWireTracker : public odb::dbBlockCallBackObj
+{
+ public:
+  void inDbWireCreate(odb::dbWire* wire) override;
+  void inDbWireDestroy(odb::dbWire* wire) override;
+  void inDbWirePostModify(odb::dbWire* wire) override;
+  void inDbWirePostAttach(odb::dbWire* wire) override;
+  void inDbWirePostDetach(odb::dbWire* wire, odb::dbNet* net) override;
+  void inDbWirePostAppend(odb::dbWire* src, odb::dbWire* dst) override;
+  void inDbWirePostCopy(odb::dbWire* src, odb::dbWire* dst) override;
+
+  const std::vector<odb::Rect>& getRemovedWires() const
+  {
+    return _removedWires;
+  }
+  void clear() { _removedWires.clear(); }
+
+ private:
+  void wireAltered(odb::dbNet* net);
+
+  std::vector<odb::Rect> _removedWires;
+};
+
 class extMain
 {
  public:
@@ -1259,6 +1287,7 @@ class extMain
       _debug_net_id = atoi(nets);
     }
   }
+  void setThreadCount(int threads) { _threads = threads; }
 
   static void createShapeProperty(odb::dbNet* net, int id, int id_val);
   static int getShapeProperty(odb::dbNet* net, int id);
@@ -1312,6 +1341,9 @@ class extMain
                      int* bb_ur,
                      uint wtype,
                      dbCreateNetUtil* createDbNet = nullptr);
+  void decodeSignalWires();
+  uint addSignalWiresOnSearch(uint dir, int* bb_ll, int* bb_ur, uint wtype);
+  uint addSignalWiresGs(bool gsRotated, bool swap_coords, int dir);
   uint addNets(uint dir,
                int* bb_ll,
                int* bb_ur,
@@ -1464,7 +1496,9 @@ class extMain
                        bool mergeViaRes,
                        double ccThres,
                        int contextDepth,
-                       const char* extRules);
+                       const char* extRules,
+                       bool incremental = false);
+  void findEcoNets(std::vector<odb::dbNet*>& nets);
 
   uint getShortSrcJid(uint jid);
   void make1stRSeg(odb::dbNet* net,
@@ -2122,6 +2156,8 @@ class extMain
   std::vector<uint> _rsegJid;
   std::vector<uint> _shortSrcJid;
   std::vector<uint> _shortTgtJid;
+  // Wire of the net in makeNetRCsegs, decoded once for junction lookups.
+  odb::dbWireShapeIndex _wire_index;
 
   std::vector<odb::dbBTerm*> _connectedBTerm;
   std::vector<odb::dbITerm*> _connectedITerm;
@@ -2212,6 +2248,25 @@ class extMain
 
   uint _debug_net_id = 0;
   float _previous_percent_extracted = 0;
+  int _threads = 1;
+
+  // Non-via wire shapes of a signal net.
+  struct NetWireShapes
+  {
+    struct Shape
+    {
+      odb::Rect box;
+      odb::dbTechLayer* layer;
+      int shapeId;
+    };
+    odb::dbNet* net;
+    std::vector<Shape> shapes;
+  };
+  // Signal wires decoded once per coupling flow, in block net order, so the
+  // band steps do not decode every wire again.
+  std::vector<NetWireShapes> _signalWires;
+
+  extWireTracker _wireTracker;
 
   double _minCapTable[64][64];
   double _maxCapTable[64][64];
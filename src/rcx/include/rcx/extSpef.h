@@ -342,6 +342,7 @@ class extSpef
 
   char _outFile[1024];
   FILE* _outFP = nullptr;
+  std::vector<char> _outBuffer;  // stdio buffer of _outFP
 
   Ath__parser* _parser = nullptr;
 
@@ -62,6 +62,7 @@ sta::define_cmd_args "extract_parasitics" {
     [-cc_model track]
     [-context_depth depth]
     [-no_merge_via_res]
+    [-incremental]
 }
 
 proc extract_parasitics { args } {
@@ -74,7 +75,8 @@ proc extract_parasitics { args } {
            -context_depth
            -cc_model } \
     flags { -lef_res
-            -no_merge_via_res }
+            -no_merge_via_res
+            -incremental }
 
   set ext_model_file ""
   if { [info exists keys(-ext_model_file)] } {
@@ -101,6 +103,7 @@ proc extract_parasitics { args } {
 
   set lef_res [info exists flags(-lef_res)]
   set no_merge_via_res [info exists flags(-no_merge_via_res)]
+  set incremental [info exists flags(-incremental)]
 
   set cc_model 10
   if { [info exists keys(-cc_model)] } {
@@ -120,7 +123,7 @@ proc extract_parasitics { args } {
 
   rcx::extract $ext_model_file $corner_cnt $max_res \
     $coupling_threshold $cc_model \
-    $depth $debug_net_id $lef_res $no_merge_via_res
+    $depth $debug_net_id $lef_res $no_merge_via_res $incremental
 }
 
 sta::define_cmd_args "write_spef" {
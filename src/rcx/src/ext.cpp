@@ -241,6 +241,7 @@ void Ext::extract(ExtractOptions options)
 
   _ext->set_debug_nets(options.debug_net);
   _ext->_lef_res = options.lef_res;
+  _ext->setThreadCount(options.threads);
 
   _ext->makeBlockRCsegs(options.net,
                         options.cc_up,
@@ -249,7 +250,8 @@ void Ext::extract(ExtractOptions options)
                         !options.no_merge_via_res,
                         options.coupling_threshold,
                         options.context_depth,
-                        options.ext_model_file);
+                        options.ext_model_file,
+                        options.incremental);
 
   logger_->info(
       RCX, 15, "Finished extracting {}.", _ext->getBlock()->getName().c_str());
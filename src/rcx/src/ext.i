@@ -70,7 +70,8 @@ extract(const char* ext_model_file,
         int context_depth,
         const char* debug_net_id,
         bool lef_res,
-        bool no_merge_via_res)
+        bool no_merge_via_res,
+        bool incremental)
 {
   Ext* ext = getOpenRCX();
   Ext::ExtractOptions opts;
@@ -84,7 +85,9 @@ extract(const char* ext_model_file,
   opts.lef_res = lef_res;
   opts.debug_net = debug_net_id;
   opts.no_merge_via_res = no_merge_via_res;
-  
+  opts.incremental = incremental;
+  opts.threads = ord::OpenRoad::openRoad()->getThreadCount();
+
   ext->extract(opts);
 }
 
@@ -806,6 +806,12 @@ uint extMain::addSignalNets(uint dir,
                             uint wtype,
                             dbCreateNetUtil* createDbNet)
 {
+  if (createDbNet == nullptr && !_signalWires.empty()) {
+    const uint cnt = addSignalWiresOnSearch(dir, bb_ll, bb_ur, wtype);
+    _search->adjustOverlapMakerEnd();
+    return cnt;
+  }
+
   uint cnt = 0;
   dbSet<dbNet> nets = _block->getNets();
   dbSet<dbNet>::iterator net_itr;
@@ -828,6 +834,104 @@ uint extMain::addSignalNets(uint dir,
   return cnt;
 }
 
+// Decode the wires of all signal nets in parallel.  Each net's shapes go
+// to its own slot so the result does not depend on the thread count.
+void extMain::decodeSignalWires()
+{
+  _signalWires.clear();
+  for (dbNet* net : _block->getNets()) {
+    if (!net->getSigType().isSupply() && net->getWire() != nullptr) {
+      _signalWires.push_back({net, {}});
+    }
+  }
+
+  const int netCnt = _signalWires.size();
+#pragma omp parallel for num_threads(_threads) schedule(dynamic, 64)
+  for (int ii = 0; ii < netCnt; ii++) {
+    NetWireShapes& wires = _signalWires[ii];
+    dbWireShapeItr shapes;
+    dbShape s;
+    for (shapes.begin(wires.net->getWire()); shapes.next(s);) {
+      if (s.isVia()) {
+        continue;
+      }
+      wires.shapes.push_back(
+          {s.getBox(), s.getTechLayer(), shapes.getShapeId()});
+    }
+  }
+}
+
+// Same as addNetShapesOnSearch for all signal nets using the decoded wires.
+uint extMain::addSignalWiresOnSearch(uint dir,
+                                     int* bb_ll,
+                                     int* bb_ur,
+                                     uint wtype)
+{
+  uint cnt = 0;
+  for (NetWireShapes& wires : _signalWires) {
+    const uint netId = wires.net->getId();
+    for (NetWireShapes::Shape& s : wires.shapes) {
+      Rect& r = s.box;
+      if (!isIncludedInsearch(r, dir, bb_ll, bb_ur)) {
+        continue;
+      }
+      const uint level = s.layer->getRoutingLevel();
+      const uint trackNum = _search->addBox(r.xMin(),
+                                            r.yMin(),
+                                            r.xMax(),
+                                            r.yMax(),
+                                            level,
+                                            netId,
+                                            s.shapeId,
+                                            wtype);
+      if (netId == _debug_net_id) {
+        debugPrint(logger_,
+                   RCX,
+                   "debug_net",
+                   1,
+                   "\t[Search:W]"
+                   "\tonSearch: tr={} L{}  DX={} DY={} {} {}  {} {} -- {:.3f} "
+                   "{:.3f}  {:.3f} {:.3f} net {}",
+                   trackNum,
+                   level,
+                   r.dx(),
+                   r.dy(),
+                   r.xMin(),
+                   r.yMin(),
+                   r.xMax(),
+                   r.yMax(),
+                   GetDBcoords1(r.xMin()),
+                   GetDBcoords1(r.yMin()),
+                   GetDBcoords1(r.xMax()),
+                   GetDBcoords1(r.yMax()),
+                   netId);
+      }
+      cnt++;
+    }
+  }
+  return cnt;
+}
+
+// Same as addNetShapesGs for all signal nets using the decoded wires.
+uint extMain::addSignalWiresGs(bool gsRotated, bool swap_coords, int dir)
+{
+  uint cnt = 0;
+  for (NetWireShapes& wires : _signalWires) {
+    const bool plane = wires.net->getSigType() == dbSigType::ANALOG;
+    for (NetWireShapes::Shape& s : wires.shapes) {
+      cnt += addShapeOnGS(wires.net,
+                          s.shapeId,
+                          s.box,
+                          plane,
+                          s.layer,
+                          gsRotated,
+                          swap_coords,
+                          dir);
+    }
+  }
+  return cnt;
+}
+
 void extMain::resetNetSpefFlag(Ath__array1D<uint>* tmpNetIdTable)
 {
   for (uint ii = 0; ii < tmpNetIdTable->getCnt(); ii++) {
@@ -1145,6 +1249,10 @@ uint extMain::fill_gs4(int dir,
   }
 
   uint scnt = 0;
+  if (!_signalWires.empty()) {
+    scnt = addSignalWiresGs(rotatedGs, !dir, gs_dir);
+    return pcnt + scnt;
+  }
 
   for (net_itr = nets.begin(); net_itr != nets.end(); ++net_itr) {
     dbNet* net = *net_itr;
@@ -1231,6 +1339,8 @@ uint extMain::couplingFlow(Rect& extRect,
 
   logger_->info(RCX, 43, "{} wires to be extracted", totWireCnt);
 
+  decodeSignalWires();
+
   uint minRes[2];
   minRes[1] = pitchTable[1];
   minRes[0] = widthTable[1];
@@ -1365,6 +1475,7 @@ uint extMain::couplingFlow(Rect& extRect,
 
   delete _geomSeq;
   _geomSeq = nullptr;
+  std::vector<NetWireShapes>().swap(_signalWires);
 
   for (uint jj = 0; jj < layerCnt; jj++) {
     delete[] limitArray[jj];
@@ -89,6 +89,7 @@ extSpef::extSpef(odb::dbTech* tech,
 
 extSpef::~extSpef()
 {
+  closeOutFile();  // _outBuffer must outlive _outFP
   delete _idMapTable;
   delete _nodeParser;
   delete _parser;
@@ -1251,6 +1252,11 @@ bool extSpef::setOutSpef(const char* filename)
     fprintf(stderr, "Cannot open file %s with permissions \"w\"", filename);
     return false;
   }
+  // The nets are written a few words per call, so use a buffer large
+  // enough that the file (or gzip pipe) sees few, large writes.
+  constexpr size_t outBufferSize = 4 << 20;
+  _outBuffer.resize(outBufferSize);
+  setvbuf(_outFP, _outBuffer.data(), _IOFBF, _outBuffer.size());
   return true;
 }
 
@@ -1265,6 +1271,7 @@ bool extSpef::closeOutFile()
   } else {
     fclose(_outFP);
   }
+  _outFP = nullptr;
 
   return true;
 }
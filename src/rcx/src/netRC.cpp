@@ -641,7 +641,8 @@ dbRSeg* extMain::addRSeg(dbNet* net,
   const uint pathDir = computePathDir(prevPoint, pshape.point, &length);
 
   Point pt;
-  if (pshape.junction_id) {
+  if (pshape.junction_id
+      && !_wire_index.getCoord(pshape.junction_id, pt)) {
     pt = net->getWire()->getCoord(pshape.junction_id);
   }
   dbRSeg* rc = dbRSeg::create(net, pt.x(), pt.y(), pathDir, true);
@@ -780,6 +781,9 @@ uint extMain::makeNetRCsegs(dbNet* net, bool skipStartWarning)
 
   uint srcJid;
   dbWire* wire = net->getWire();
+  // Every rseg looks up its junction point; dbWire::getCoord would walk
+  // the wire back from each one.
+  _wire_index.build(wire);
   dbWirePathItr pitr;
   if (_mergeResBound != 0.0 || _mergeViaRes) {
     dbWirePath path;
@@ -1715,7 +1719,8 @@ void extMain::makeBlockRCsegs(const char* netNames,
                               bool mergeViaRes,
                               double ccThres,
                               int contextDepth,
-                              const char* extRules)
+                              const char* extRules,
+                              bool incremental)
 {
   uint debugNetId = 0;
 
@@ -1755,7 +1760,30 @@ void extMain::makeBlockRCsegs(const char* netNames,
   }
   _foreign = false;  // extract after read_spef
 
-  _allNet = !((dbBlock*) _block)->findSomeNet(netNames, inets);
+  if (incremental) {
+    int numOfNet;
+    int numOfRSeg;
+    int numOfCapNode;
+    int numOfCCSeg;
+    _block->getExtCount(numOfNet, numOfRSeg, numOfCapNode, numOfCCSeg);
+    if (numOfRSeg == 0) {
+      logger_->info(RCX, 498, "No parasitics to update, extracting all nets.");
+      incremental = false;
+    }
+  }
+  if (incremental) {
+    findEcoNets(inets);
+    if (inets.empty()) {
+      logger_->info(RCX, 499, "No nets changed since the last extraction.");
+      _wireTracker.clear();
+      return;
+    }
+    logger_->info(RCX, 500, "Extracting {} changed nets.", inets.size());
+    removeExt(inets);
+    _allNet = false;
+  } else {
+    _allNet = !((dbBlock*) _block)->findSomeNet(netNames, inets);
+  }
 
   if (_ccContextDepth) {
     initContextArray();
@@ -1941,6 +1969,8 @@ void extMain::makeBlockRCsegs(const char* netNames,
       net->setWireAltered(false);
     }
   }
+  _wireTracker.clear();
+  _wireTracker.addOwner(_block);
 
   _modelTable->resetCnt(0);
   if (_batchScaleExt) {
@@ -1948,6 +1978,132 @@ void extMain::makeBlockRCsegs(const char* netNames,
   }
 }
 
+// Collect the signal nets whose wires changed since the last extraction
+// together with the nets they coupled to before the change and the nets
+// within coupling distance of the changed or removed wires now.
+void extMain::findEcoNets(std::vector<dbNet*>& nets)
+{
+  std::vector<dbNet*> changed;
+  for (dbNet* net : _block->getNets()) {
+    if (!net->getSigType().isSupply() && net->isWireAltered()) {
+      changed.push_back(net);
+    }
+  }
+  std::vector<Rect> areas = _wireTracker.getRemovedWires();
+  if (changed.empty() && areas.empty()) {
+    return;
+  }
+
+  std::vector<dbNet*> halo;
+  _block->getCcHaloNets(changed, halo);
+
+  // Same lateral reach as couplingFlow: ccFlag tracks of the widest pitch.
+  int maxPitch = 0;
+  for (dbTechLayer* layer : _tech->getLayers()) {
+    if (layer->getType() == dbTechLayerType::ROUTING) {
+      maxPitch = std::max(maxPitch, layer->getPitch());
+    }
+  }
+  const int ccDist = _couplingFlag * maxPitch;
+
+  for (dbNet* net : changed) {
+    dbWire* wire = net->getWire();
+    if (wire == nullptr) {
+      continue;
+    }
+    const auto bbox = wire->getBBox();
+    if (bbox) {
+      areas.push_back(bbox.value());
+    }
+  }
+  Rect bound;
+  bound.mergeInit();
+  for (Rect& r : areas) {
+    r.bloat(ccDist, r);
+    bound.merge(r);
+  }
+
+  for (dbNet* net : changed) {
+    net->setMark(true);
+    nets.push_back(net);
+  }
+  for (dbNet* net : halo) {
+    if (!net->isMarked() && !net->getSigType().isSupply()) {
+      net->setMark(true);
+      nets.push_back(net);
+    }
+  }
+  for (dbNet* net : _block->getNets()) {
+    if (net->isMarked() || net->getSigType().isSupply()) {
+      continue;
+    }
+    dbWire* wire = net->getWire();
+    if (wire == nullptr) {
+      continue;
+    }
+    const auto bbox = wire->getBBox();
+    if (!bbox || !bound.intersects(bbox.value())) {
+      continue;
+    }
+    for (const Rect& r : areas) {
+      if (r.intersects(bbox.value())) {
+        net->setMark(true);
+        nets.push_back(net);
+        break;
+      }
+    }
+  }
+  for (dbNet* net : nets) {
+    net->setMark(false);
+  }
+}
+
+void extWireTracker::wireAltered(dbNet* net)
+{
+  if (net != nullptr && !net->isWireAltered()) {
+    net->setWireAltered(true);
+  }
+}
+
+void extWireTracker::inDbWireCreate(dbWire* wire)
+{
+  wireAltered(wire->getNet());
+}
+
+void extWireTracker::inDbWireDestroy(dbWire* wire)
+{
+  wireAltered(wire->getNet());
+  const auto bbox = wire->getBBox();
+  if (bbox) {
+    _removedWires.push_back(bbox.value());
+  }
+}
+
+void extWireTracker::inDbWirePostModify(dbWire* wire)
+{
+  wireAltered(wire->getNet());
+}
+
+void extWireTracker::inDbWirePostAttach(dbWire* wire)
+{
+  wireAltered(wire->getNet());
+}
+
+void extWireTracker::inDbWirePostDetach(dbWire* wire, dbNet* net)
+{
+  wireAltered(net);
+}
+
+void extWireTracker::inDbWirePostAppend(dbWire* src, dbWire* dst)
+{
+  wireAltered(dst->getNet());
+}
+
+void extWireTracker::inDbWirePostCopy(dbWire* src, dbWire* dst)
+{
+  wireAltered(dst->getNet());
+}
+
 void extMain::genScaledExt()
 {
   if (_processCornerTable == nullptr || _scaledCornerTable == nullptr) {
@@ -0,0 +1,63 @@
+# extract_parasitics -incremental after a wire edit must match a full
+# extraction of the edited design.
+source helpers.tcl
+
+read_lef sky130hs/sky130hs.tlef
+read_lef sky130hs/sky130hs_std_cell.lef
+read_liberty sky130hs/sky130hs_tt.lib
+
+read_def gcd.def
+
+source sky130hs/sky130hs.rc
+
+define_process_corner -ext_model_index 0 X
+extract_parasitics -ext_model_file ext_pattern.rules \
+      -max_res 0 -coupling_threshold 0.1
+
+set block [ord::get_db_block]
+
+# Remove the wire of the first signal net that has coupling caps.
+set edit_net ""
+foreach net [$block getNets] {
+  if { [$net getSigType] != "SIGNAL" || [$net getWire] == "NULL" } {
+    continue
+  }
+  if { [$net getTotalCouplingCap] > 0 } {
+    set edit_net $net
+    break
+  }
+}
+if { $edit_net == "" } {
+  puts "fail - no coupled signal net"
+  exit 1
+}
+odb::dbWire_destroy [$edit_net getWire]
+
+extract_parasitics -ext_model_file ext_pattern.rules \
+      -max_res 0 -coupling_threshold 0.1 -incremental
+
+if { [$edit_net getRSegCount] != 0 || [$edit_net getTotalCouplingCap] != 0 } {
+  puts "fail - [$edit_net getName] keeps parasitics of its removed wire"
+  exit 1
+}
+
+set incr_caps {}
+foreach net [$block getNets] {
+  dict set incr_caps [$net getName] [$net getTotalCapacitance 0 1]
+}
+
+extract_parasitics -ext_model_file ext_pattern.rules \
+      -max_res 0 -coupling_threshold 0.1
+
+foreach net [$block getNets] {
+  set name [$net getName]
+  set full [$net getTotalCapacitance 0 1]
+  set incr [dict get $incr_caps $name]
+  if { abs($full - $incr) > 1e-3 * max(abs($full), 1e-6) } {
+    puts "fail - $name incremental $incr full $full"
+    exit 1
+  }
+}
+
+puts "pass"
+exit
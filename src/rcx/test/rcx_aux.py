@@ -17,7 +17,8 @@ def extract_parasitics(*, ext_model_file=None,
                        lef_res=False,
                        cc_model=10,
                        context_depth=5,
-                       no_merge_via_res=False
+                       no_merge_via_res=False,
+                       incremental=False
                        ):
     # NOTE: This is position dependent
     rcx.extract(ext_model_file,
@@ -28,7 +29,8 @@ def extract_parasitics(*, ext_model_file=None,
                 context_depth,
                 debug_net_id,
                 lef_res,
-                no_merge_via_res)
+                no_merge_via_res,
+                incremental)
 
 
 def write_spef(*, filename="", nets="", net_id=0, coordinates=False):
@@ -9,5 +9,6 @@ record_tests {
   #rcx_readme_msgs_check
 }
 record_pass_fail_tests {
+  incremental
   rcx_unit_test
 }
@@ -38,6 +38,7 @@
 #include <array>
 #include <optional>
 #include <string>
+#include <unordered_set>
 
 #include "db_sta/dbSta.hh"
 #include "dpl/Opendp.h"
@@ -102,6 +103,7 @@ using sta::Parasitic;
 using sta::ParasiticAnalysisPt;
 using sta::ParasiticNode;
 using sta::Parasitics;
+using sta::PathRef;
 using sta::Pin;
 using sta::PinSeq;
 using sta::PinSet;
@@ -130,6 +132,7 @@ using BufferedNetPtr = std::shared_ptr<BufferedNet>;
 using PinPtr = const sta::Pin*;
 using PinVector = std::vector<PinPtr>;
 
+class GateDelayCache;
 class RecoverPower;
 class RepairDesign;
 class RepairSetup;
@@ -244,6 +247,44 @@ class Resizer : public dbStaState
   bool dontTouch(const Net* net);
 
   void setMaxUtilization(double max_utilization);
+  // Netlist edits made between ecoBegin and ecoCommit only mark the nets
+  // they touch; the parasitics of each marked net are updated once by the
+  // outermost ecoCommit instead of after every edit. Prefer EcoScope.
+  void ecoBegin();
+  void ecoCommit();
+  // Ends an ECO without updating parasitics. The marked nets stay invalid
+  // until the next updateParasitics.
+  void ecoAbandon();
+  // Calls ecoBegin on construction. commit must be called to end the ECO
+  // with ecoCommit; a scope left without it, such as by an exception, calls
+  // ecoAbandon so the destructor never updates parasitics.
+  class EcoScope
+  {
+   public:
+    explicit EcoScope(Resizer* resizer) : resizer_(resizer)
+    {
+      resizer_->ecoBegin();
+    }
+    ~EcoScope()
+    {
+      if (!committed_) {
+        resizer_->ecoAbandon();
+      }
+    }
+    EcoScope(const EcoScope&) = delete;
+    EcoScope& operator=(const EcoScope&) = delete;
+    void commit()
+    {
+      if (!committed_) {
+        committed_ = true;
+        resizer_->ecoCommit();
+      }
+    }
+
+   private:
+    Resizer* resizer_;
+    bool committed_ = false;
+  };
   // Remove all or selected buffers from the netlist.
   void removeBuffers(InstanceSeq insts);
   void bufferInputs();
@@ -266,7 +307,8 @@ class Resizer : public dbStaState
                    bool verbose,
                    bool skip_pin_swap,
                    bool skip_gate_cloning,
-                   bool skip_buffer_removal);
+                   bool skip_buffer_removal,
+                   int batch_endpoints = 1);
   // For testing.
   void repairSetup(const Pin* end_pin);
   // For testing.
@@ -283,7 +325,8 @@ class Resizer : public dbStaState
                   // Max buffer count as percent of design instance count.
                   float max_buffer_percent,
                   int max_passes,
-                  bool verbose);
+                  bool verbose,
+                  int batch_endpoints = 1);
   void repairHold(const Pin* end_pin,
                   double setup_margin,
                   double hold_margin,
@@ -487,6 +530,12 @@ class Resizer : public dbStaState
                     // Return values.
                     ArcDelay delays[RiseFall::index_count],
                     Slew slews[RiseFall::index_count]);
+  // Interpolated from GateDelayCache. Only for screening candidates; the
+  // ones kept are compared with bufferDelay.
+  float bufferDelayEstimate(LibertyCell* buffer_cell,
+                            const RiseFall* rf,
+                            float load_cap,
+                            const DcalcAnalysisPt* dcalc_ap);
   void cellWireDelay(LibertyPort* drvr_port,
                      LibertyPort* load_port,
                      double wire_length,  // meters
@@ -534,6 +583,11 @@ class Resizer : public dbStaState
   void ensureWireParasitic(const Pin* drvr_pin);
   void ensureWireParasitic(const Pin* drvr_pin, const Net* net);
   void estimateWireParasiticSteiner(const Pin* drvr_pin, const Net* net);
+  void makeWireParasiticSteiner(const Pin* drvr_pin,
+                                const Net* net,
+                                SteinerTree* tree);
+  void estimateWireParasiticsParallel(int thread_count);
+  bool needsWireParasitic(const Pin* drvr_pin, const Net* net);
   float totalLoad(SteinerTree* tree) const;
   float subtreeLoad(SteinerTree* tree,
                     float cap_per_micron,
@@ -588,6 +642,11 @@ class Resizer : public dbStaState
   void warnBufferMovedIntoCore();
   bool isLogicStdCell(const Instance* inst);
   void invalidateParasitics(const Pin* pin, const Net* net);
+  // Add the instances on path to path_insts unless one of them is already
+  // there. Batched repairs use it to pick paths that share no instances.
+  bool addPathInsts(PathRef& path,
+                    std::unordered_set<const Instance*>& path_insts);
+
   ////////////////////////////////////////////////////////////////
   // Jounalling support for checkpointing and backing out changes
   // during repair timing.
@@ -621,6 +680,8 @@ class Resizer : public dbStaState
   RepairDesign* repair_design_;
   RepairSetup* repair_setup_;
   RepairHold* repair_hold_;
+  // Characterized driver delays shared by repair_design and repair_timing.
+  GateDelayCache* gate_delay_cache_;
   std::unique_ptr<AbstractSteinerRenderer> steiner_renderer_;
 
   // Layer RC per wire length indexed by layer->getNumber(), corner->index
@@ -650,6 +711,8 @@ class Resizer : public dbStaState
 
   ParasiticsSrc parasitics_src_ = ParasiticsSrc::none;
   UnorderedSet<const Net*, NetHash> parasitics_invalid_;
+  // Nesting depth of ecoBegin/ecoCommit.
+  int eco_depth_ = 0;
 
   double design_area_ = 0.0;
   const MinMax* min_ = MinMax::min();
@@ -700,8 +763,12 @@ class Resizer : public dbStaState
   static constexpr float tgt_slew_load_cap_factor = 10.0;
   // Prim/Dijkstra gets out of hand with bigger nets.
   static constexpr int max_steiner_pin_count_ = 200000;
+  // Nets whose Steiner trees are built in parallel before their parasitics
+  // are made.
+  static constexpr int parallel_parasitics_batch_ = 16384;
 
   friend class BufferedNet;
+  friend class GateDelayCache;
   friend class GateCloner;
   friend class PreChecks;
   friend class RecoverPower;
@@ -33,6 +33,10 @@
 //
 ///////////////////////////////////////////////////////////////////////////////
 
+#include <algorithm>
+#include <utility>
+#include <vector>
+
 #include "SteinerTree.hh"
 #include "db_sta/dbNetwork.hh"
 #include "grt/GlobalRouter.h"
@@ -44,6 +48,7 @@
 #include "sta/Report.hh"
 #include "sta/Sdc.hh"
 #include "sta/Units.hh"
+#include "stt/flute.h"
 #include "utl/Logger.h"
 
 namespace rsz {
@@ -344,6 +349,35 @@ void Resizer::updateParasitics(bool save_guides)
   }
 }
 
+void Resizer::ecoBegin()
+{
+  eco_depth_++;
+}
+
+void Resizer::ecoCommit()
+{
+  if (eco_depth_ == 0) {
+    logger_->critical(RSZ, 98, "ecoCommit called without ecoBegin.");
+  }
+  eco_depth_--;
+  if (eco_depth_ == 0 && !parasitics_invalid_.empty()) {
+    debugPrint(logger_,
+               RSZ,
+               "resizer_parasitics",
+               1,
+               "eco commit updates {} nets",
+               parasitics_invalid_.size());
+    updateParasitics();
+  }
+}
+
+void Resizer::ecoAbandon()
+{
+  if (eco_depth_ > 0) {
+    eco_depth_--;
+  }
+}
+
 bool Resizer::parasiticsValid() const
 {
   return parasitics_invalid_.empty();
@@ -394,18 +428,77 @@ void Resizer::estimateWireParasitics()
     // Make separate parasitics for each corner, same for min/max.
     sta_->setParasiticAnalysisPts(true);
 
-    NetIterator* net_iter = network_->netIterator(network_->topInstance());
-    while (net_iter->hasNext()) {
-      Net* net = net_iter->next();
-      estimateWireParasitic(net);
+    const int thread_count = sta_->threadCount();
+    if (thread_count > 1) {
+      estimateWireParasiticsParallel(thread_count);
+    } else {
+      NetIterator* net_iter = network_->netIterator(network_->topInstance());
+      while (net_iter->hasNext()) {
+        Net* net = net_iter->next();
+        estimateWireParasitic(net);
+      }
+      delete net_iter;
     }
-    delete net_iter;
 
     parasitics_src_ = ParasiticsSrc::placement;
     parasitics_invalid_.clear();
   }
 }
 
+// The Steiner trees of the nets are independent and dominate the run time,
+// so they are built in parallel a batch of nets at a time. The parasitic
+// networks are then made and reduced serially because the parasitics
+// store and delay calculator are not thread safe.
+void Resizer::estimateWireParasiticsParallel(int thread_count)
+{
+  std::vector<std::pair<const Pin*, const Net*>> drvr_nets;
+  NetIterator* net_iter = network_->netIterator(network_->topInstance());
+  while (net_iter->hasNext()) {
+    const Net* net = net_iter->next();
+    PinSet* drivers = network_->drivers(net);
+    if (drivers && !drivers->empty()) {
+      PinSet::Iterator drvr_iter(drivers);
+      const Pin* drvr_pin = drvr_iter.next();
+      if (needsWireParasitic(drvr_pin, net)) {
+        drvr_nets.emplace_back(drvr_pin, net);
+      }
+    }
+  }
+  delete net_iter;
+
+  stt::flt::initAllLUT();
+
+  const int net_count = drvr_nets.size();
+  std::vector<SteinerTree*> trees;
+  std::vector<char> pad_nets;
+  for (int begin = 0; begin < net_count; begin += parallel_parasitics_batch_) {
+    const int end = std::min(begin + parallel_parasitics_batch_, net_count);
+    trees.assign(end - begin, nullptr);
+    pad_nets.assign(end - begin, false);
+
+#pragma omp parallel for num_threads(thread_count) schedule(dynamic, 64)
+    for (int i = begin; i < end; i++) {
+      const auto& [drvr_pin, net] = drvr_nets[i];
+      if (isPadNet(net)) {
+        pad_nets[i - begin] = true;
+      } else {
+        trees[i - begin] = makeSteinerTree(drvr_pin);
+      }
+    }
+
+    for (int i = begin; i < end; i++) {
+      const auto& [drvr_pin, net] = drvr_nets[i];
+      SteinerTree* tree = trees[i - begin];
+      if (pad_nets[i - begin]) {
+        makePadParasitic(net);
+      } else if (tree) {
+        makeWireParasiticSteiner(drvr_pin, net, tree);
+        delete tree;
+      }
+    }
+  }
+}
+
 void Resizer::estimateWireParasitic(const Net* net)
 {
   PinSet* drivers = network_->drivers(net);
@@ -416,11 +509,16 @@ void Resizer::estimateWireParasitic(const Net* net)
   }
 }
 
+bool Resizer::needsWireParasitic(const Pin* drvr_pin, const Net* net)
+{
+  return !network_->isPower(net) && !network_->isGround(net)
+         && !sta_->isIdealClock(drvr_pin)
+         && !db_network_->staToDb(net)->isSpecial();
+}
+
 void Resizer::estimateWireParasitic(const Pin* drvr_pin, const Net* net)
 {
-  if (!network_->isPower(net) && !network_->isGround(net)
-      && !sta_->isIdealClock(drvr_pin)
-      && !db_network_->staToDb(net)->isSpecial()) {
+  if (needsWireParasitic(drvr_pin, net)) {
     if (isPadNet(net)) {
       // When an input port drives a pad instance with huge input
       // cap the elmore delay is gigantic. Annotate with zero
@@ -467,86 +565,93 @@ void Resizer::estimateWireParasiticSteiner(const Pin* drvr_pin, const Net* net)
 {
   SteinerTree* tree = makeSteinerTree(drvr_pin);
   if (tree) {
-    debugPrint(logger_,
-               RSZ,
-               "resizer_parasitics",
-               1,
-               "estimate wire {}",
-               sdc_network_->pathName(net));
-    for (Corner* corner : *sta_->corners()) {
-      const ParasiticAnalysisPt* parasitics_ap
-          = corner->findParasiticAnalysisPt(max_);
-      Parasitic* parasitic
-          = sta_->makeParasiticNetwork(net, false, parasitics_ap);
-      bool is_clk = global_router_->isNonLeafClock(db_network_->staToDb(net));
-      double wire_cap = 0.0;
-      double wire_res = 0.0;
-      int branch_count = tree->branchCount();
-      size_t resistor_id = 1;
-      for (int i = 0; i < branch_count; i++) {
-        Point pt1, pt2;
-        SteinerPt steiner_pt1, steiner_pt2;
-        int wire_length_dbu;
-        tree->branch(i, pt1, steiner_pt1, pt2, steiner_pt2, wire_length_dbu);
-        if (wire_length_dbu) {
-          double dx = dbuToMeters(abs(pt1.x() - pt2.x()))
-                      / dbuToMeters(wire_length_dbu);
-          double dy = dbuToMeters(abs(pt1.y() - pt2.y()))
-                      / dbuToMeters(wire_length_dbu);
-
-          if (is_clk) {
-            wire_cap = dx * wireClkHCapacitance(corner)
-                       + dy * wireClkVCapacitance(corner);
-            wire_res = dx * wireClkHResistance(corner)
-                       + dy * wireClkVResistance(corner);
-          } else {
-            wire_cap = dx * wireSignalHCapacitance(corner)
-                       + dy * wireSignalVCapacitance(corner);
-            wire_res = dx * wireSignalHResistance(corner)
-                       + dy * wireSignalVResistance(corner);
-          }
-        } else {
-          wire_cap = is_clk ? wireClkCapacitance(corner)
-                            : wireSignalCapacitance(corner);
-          wire_res = is_clk ? wireClkResistance(corner)
-                            : wireSignalResistance(corner);
-        }
-        ParasiticNode* n1 = parasitics_->ensureParasiticNode(
-            parasitic, net, steiner_pt1, network_);
-        ParasiticNode* n2 = parasitics_->ensureParasiticNode(
-            parasitic, net, steiner_pt2, network_);
-        if (wire_length_dbu == 0) {
-          // Use a small resistor to keep the connectivity intact.
-          parasitics_->makeResistor(parasitic, resistor_id++, 1.0e-3, n1, n2);
+    makeWireParasiticSteiner(drvr_pin, net, tree);
+    delete tree;
+  }
+}
+
+void Resizer::makeWireParasiticSteiner(const Pin* drvr_pin,
+                                       const Net* net,
+                                       SteinerTree* tree)
+{
+  debugPrint(logger_,
+             RSZ,
+             "resizer_parasitics",
+             1,
+             "estimate wire {}",
+             sdc_network_->pathName(net));
+  for (Corner* corner : *sta_->corners()) {
+    const ParasiticAnalysisPt* parasitics_ap
+        = corner->findParasiticAnalysisPt(max_);
+    Parasitic* parasitic
+        = sta_->makeParasiticNetwork(net, false, parasitics_ap);
+    bool is_clk = global_router_->isNonLeafClock(db_network_->staToDb(net));
+    double wire_cap = 0.0;
+    double wire_res = 0.0;
+    int branch_count = tree->branchCount();
+    size_t resistor_id = 1;
+    for (int i = 0; i < branch_count; i++) {
+      Point pt1, pt2;
+      SteinerPt steiner_pt1, steiner_pt2;
+      int wire_length_dbu;
+      tree->branch(i, pt1, steiner_pt1, pt2, steiner_pt2, wire_length_dbu);
+      if (wire_length_dbu) {
+        double dx = dbuToMeters(abs(pt1.x() - pt2.x()))
+                    / dbuToMeters(wire_length_dbu);
+        double dy = dbuToMeters(abs(pt1.y() - pt2.y()))
+                    / dbuToMeters(wire_length_dbu);
+
+        if (is_clk) {
+          wire_cap = dx * wireClkHCapacitance(corner)
+                     + dy * wireClkVCapacitance(corner);
+          wire_res = dx * wireClkHResistance(corner)
+                     + dy * wireClkVResistance(corner);
         } else {
-          double length = dbuToMeters(wire_length_dbu);
-          double cap = length * wire_cap;
-          double res = length * wire_res;
-          // Make pi model for the wire.
-          debugPrint(logger_,
-                     RSZ,
-                     "resizer_parasitics",
-                     2,
-                     " pi {} l={} c2={} rpi={} c1={} {}",
-                     parasitics_->name(n1),
-                     units_->distanceUnit()->asString(length),
-                     units_->capacitanceUnit()->asString(cap / 2.0),
-                     units_->resistanceUnit()->asString(res),
-                     units_->capacitanceUnit()->asString(cap / 2.0),
-                     parasitics_->name(n2));
-          parasitics_->incrCap(n1, cap / 2.0);
-          parasitics_->makeResistor(parasitic, resistor_id++, res, n1, n2);
-          parasitics_->incrCap(n2, cap / 2.0);
+          wire_cap = dx * wireSignalHCapacitance(corner)
+                     + dy * wireSignalVCapacitance(corner);
+          wire_res = dx * wireSignalHResistance(corner)
+                     + dy * wireSignalVResistance(corner);
         }
-        parasiticNodeConnectPins(parasitic, n1, tree, steiner_pt1, resistor_id);
-        parasiticNodeConnectPins(parasitic, n2, tree, steiner_pt2, resistor_id);
+      } else {
+        wire_cap = is_clk ? wireClkCapacitance(corner)
+                          : wireSignalCapacitance(corner);
+        wire_res = is_clk ? wireClkResistance(corner)
+                          : wireSignalResistance(corner);
       }
-      arc_delay_calc_->reduceParasitic(
-          parasitic, net, corner, sta::MinMaxAll::all());
+      ParasiticNode* n1 = parasitics_->ensureParasiticNode(
+          parasitic, net, steiner_pt1, network_);
+      ParasiticNode* n2 = parasitics_->ensureParasiticNode(
+          parasitic, net, steiner_pt2, network_);
+      if (wire_length_dbu == 0) {
+        // Use a small resistor to keep the connectivity intact.
+        parasitics_->makeResistor(parasitic, resistor_id++, 1.0e-3, n1, n2);
+      } else {
+        double length = dbuToMeters(wire_length_dbu);
+        double cap = length * wire_cap;
+        double res = length * wire_res;
+        // Make pi model for the wire.
+        debugPrint(logger_,
+                   RSZ,
+                   "resizer_parasitics",
+                   2,
+                   " pi {} l={} c2={} rpi={} c1={} {}",
+                   parasitics_->name(n1),
+                   units_->distanceUnit()->asString(length),
+                   units_->capacitanceUnit()->asString(cap / 2.0),
+                   units_->resistanceUnit()->asString(res),
+                   units_->capacitanceUnit()->asString(cap / 2.0),
+                   parasitics_->name(n2));
+        parasitics_->incrCap(n1, cap / 2.0);
+        parasitics_->makeResistor(parasitic, resistor_id++, res, n1, n2);
+        parasitics_->incrCap(n2, cap / 2.0);
+      }
+      parasiticNodeConnectPins(parasitic, n1, tree, steiner_pt1, resistor_id);
+      parasiticNodeConnectPins(parasitic, n2, tree, steiner_pt2, resistor_id);
     }
-    parasitics_->deleteParasiticNetworks(net);
-    delete tree;
+    arc_delay_calc_->reduceParasitic(
+        parasitic, net, corner, sta::MinMaxAll::all());
   }
+  parasitics_->deleteParasiticNetworks(net);
 }
 
 float Resizer::pinCapacitance(const Pin* pin,
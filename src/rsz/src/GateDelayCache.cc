@@ -0,0 +1,132 @@
+/////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (c) 2024, Precision Innovations Inc.
+// All rights reserved.
+//
+// BSD 3-Clause License
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+
+#include "GateDelayCache.hh"
+
+#include <algorithm>
+
+#include "rsz/Resizer.hh"
+#include "sta/DcalcAnalysisPt.hh"
+#include "sta/Liberty.hh"
+#include "sta/MinMax.hh"
+#include "utl/Logger.h"
+
+namespace rsz {
+
+using sta::MinMax;
+using utl::RSZ;
+
+GateDelayCache::GateDelayCache(Resizer* resizer) : resizer_(resizer)
+{
+}
+
+void GateDelayCache::clear()
+{
+  tables_.clear();
+  hits_ = 0;
+  misses_ = 0;
+}
+
+void GateDelayCache::gateDelays(const LibertyPort* drvr_port,
+                                const float load_cap,
+                                const DcalcAnalysisPt* dcalc_ap,
+                                // Return values.
+                                ArcDelay delays[RiseFall::index_count],
+                                Slew slews[RiseFall::index_count])
+{
+  const Table& table = findTable(drvr_port, dcalc_ap);
+  const float pos = table.load_step > 0.0 ? load_cap / table.load_step : -1.0;
+  if (pos < 0.0 || pos > load_samples_ - 1) {
+    misses_++;
+    resizer_->gateDelays(drvr_port, load_cap, dcalc_ap, delays, slews);
+    return;
+  }
+  hits_++;
+  const int sample = std::min(static_cast<int>(pos), load_samples_ - 2);
+  const float frac = pos - sample;
+  for (int rf_index : RiseFall::rangeIndex()) {
+    const int i0 = sample * RiseFall::index_count + rf_index;
+    const int i1 = i0 + RiseFall::index_count;
+    delays[rf_index]
+        = table.delays[i0] + (table.delays[i1] - table.delays[i0]) * frac;
+    slews[rf_index]
+        = table.slews[i0] + (table.slews[i1] - table.slews[i0]) * frac;
+  }
+}
+
+const GateDelayCache::Table& GateDelayCache::findTable(
+    const LibertyPort* drvr_port,
+    const DcalcAnalysisPt* dcalc_ap)
+{
+  const auto key = std::make_pair(drvr_port, dcalc_ap->index());
+  auto itr = tables_.find(key);
+  if (itr != tables_.end()) {
+    return itr->second;
+  }
+
+  Table& table = tables_[key];
+  float max_cap;
+  bool exists;
+  drvr_port->capacitanceLimit(MinMax::max(), max_cap, exists);
+  if (exists && max_cap > 0.0) {
+    table.load_step = max_cap / (load_samples_ - 1);
+    table.delays.resize(load_samples_ * RiseFall::index_count);
+    table.slews.resize(load_samples_ * RiseFall::index_count);
+    for (int sample = 0; sample < load_samples_; sample++) {
+      const int i = sample * RiseFall::index_count;
+      resizer_->gateDelays(drvr_port,
+                           sample * table.load_step,
+                           dcalc_ap,
+                           &table.delays[i],
+                           &table.slews[i]);
+    }
+  }
+  return table;
+}
+
+void GateDelayCache::reportStats() const
+{
+  const int lookups = hits_ + misses_;
+  debugPrint(resizer_->logger(),
+             RSZ,
+             "gate_delay_cache",
+             1,
+             "{} tables {} hits {} misses ({:.1f}% hit rate)",
+             tables_.size(),
+             hits_,
+             misses_,
+             lookups > 0 ? 100.0 * hits_ / lookups : 0.0);
+}
+
+}  // namespace rsz
@@ -0,0 +1,100 @@
+/////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (c) 2024, Precision Innovations Inc.
+// All rights reserved.
+//
+// BSD 3-Clause License
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+
+#pragma once
+
+#include <map>
+#include <utility>
+#include <vector>
+
+#include "sta/Corner.hh"
+#include "sta/Delay.hh"
+#include "sta/LibertyClass.hh"
+#include "sta/Transition.hh"
+
+namespace rsz {
+
+class Resizer;
+
+using sta::ArcDelay;
+using sta::DcalcAnalysisPt;
+using sta::LibertyPort;
+using sta::RiseFall;
+using sta::Slew;
+
+// Driver delays and slews versus load capacitance at the target input
+// slew, characterized once per driver port and corner so the rebuffer and
+// repeater searches interpolate a table instead of running the delay
+// calculator for every candidate load. Loads above the port's max
+// capacitance, and ports without one, are computed directly.
+// Interpolated values are only used to screen candidates; the final
+// choice is always made with Resizer::gateDelays.
+class GateDelayCache
+{
+ public:
+  GateDelayCache(Resizer* resizer);
+  // Drop the tables and reset the counters.
+  void clear();
+  void gateDelays(const LibertyPort* drvr_port,
+                  float load_cap,
+                  const DcalcAnalysisPt* dcalc_ap,
+                  // Return values.
+                  ArcDelay delays[RiseFall::index_count],
+                  Slew slews[RiseFall::index_count]);
+  int hits() const { return hits_; }
+  int misses() const { return misses_; }
+  void reportStats() const;
+
+ private:
+  struct Table
+  {
+    // Load cap between samples; zero if the port is not tabulated.
+    float load_step = 0.0;
+    // Indexed by sample * RiseFall::index_count + rf_index.
+    std::vector<ArcDelay> delays;
+    std::vector<Slew> slews;
+  };
+
+  const Table& findTable(const LibertyPort* drvr_port,
+                         const DcalcAnalysisPt* dcalc_ap);
+
+  Resizer* resizer_;
+  std::map<std::pair<const LibertyPort*, int>, Table> tables_;
+  int hits_ = 0;
+  int misses_ = 0;
+
+  static constexpr int load_samples_ = 128;
+};
+
+}  // namespace rsz
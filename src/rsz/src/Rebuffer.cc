@@ -33,6 +33,9 @@
 //
 ///////////////////////////////////////////////////////////////////////////////
 
+#include <utility>
+#include <vector>
+
 #include "BufferedNet.hh"
 #include "RepairSetup.hh"
 #include "db_sta/dbNetwork.hh"
@@ -352,22 +355,44 @@ BufferedNetSeq RepairSetup::addWireAndBuffer(const BufferedNetSeq& Z,
   if (!Z1.empty()) {
     BufferedNetSeq buffered_options;
     for (LibertyCell* buffer_cell : resizer_->buffer_cells_) {
-      Required best_req = -INF;
-      BufferedNetPtr best_option = nullptr;
+      // Screen the options with the characterized buffer delays and only
+      // compare those close to the best one with exact delays.
+      std::vector<std::pair<Required, BufferedNetPtr>> screened;
+      Required best_screen_req = -INF;
+      Delay best_screen_delay = 0.0;
       for (const BufferedNetPtr& z : Z1) {
         PathRef req_path = z->requiredPath();
         // Do not buffer unconstrained paths.
         if (!req_path.isNull()) {
           const DcalcAnalysisPt* dcalc_ap = req_path.dcalcAnalysisPt(sta_);
-          Delay buffer_delay = resizer_->bufferDelay(
+          const Delay buffer_delay = resizer_->bufferDelayEstimate(
               buffer_cell, req_path.transition(sta_), z->cap(), dcalc_ap);
-          Required req = z->required(sta_) - buffer_delay;
-          if (fuzzyGreater(req, best_req)) {
-            best_req = req;
-            best_option = z;
+          const Required req = z->required(sta_) - buffer_delay;
+          screened.emplace_back(req, z);
+          if (req > best_screen_req) {
+            best_screen_req = req;
+            best_screen_delay = buffer_delay;
           }
         }
       }
+      const Required screen_req
+          = best_screen_req - best_screen_delay * rebuffer_screen_margin_;
+      Required best_req = -INF;
+      BufferedNetPtr best_option = nullptr;
+      for (const auto& [screen_option_req, z] : screened) {
+        if (screen_option_req < screen_req) {
+          continue;
+        }
+        PathRef req_path = z->requiredPath();
+        const DcalcAnalysisPt* dcalc_ap = req_path.dcalcAnalysisPt(sta_);
+        const Delay buffer_delay = resizer_->bufferDelay(
+            buffer_cell, req_path.transition(sta_), z->cap(), dcalc_ap);
+        const Required req = z->required(sta_) - buffer_delay;
+        if (fuzzyGreater(req, best_req)) {
+          best_req = req;
+          best_option = z;
+        }
+      }
       if (best_option) {
         Required required = INF;
         PathRef req_path = best_option->requiredPath();
@@ -36,6 +36,7 @@
 #include "RepairDesign.hh"
 
 #include "BufferedNet.hh"
+#include "GateDelayCache.hh"
 #include "db_sta/dbNetwork.hh"
 #include "rsz/Resizer.hh"
 #include "sta/Corner.hh"
@@ -680,17 +681,45 @@ double RepairDesign::findSlewLoadCap(LibertyPort* drvr_port,
   // cap2 upper bound
   double cap1 = 0.0;
   double cap2 = slew / drvr_res * 2;
+  // Bracket the cap with the characterized slews, then check the bracket
+  // with exact slews, widening it where the interpolation was off, and
+  // finish the search with them.
+  searchSlewLoadCap(drvr_port, slew, dcalc_ap, true, cap1, cap2);
+  const double min_cap = cap1 * .01;
+  while (cap1 > 0.0
+         && gateSlewDiff(drvr_port, cap1, slew, dcalc_ap, false) >= 0.0) {
+    cap2 = cap1;
+    cap1 = cap1 / 2 > min_cap ? cap1 / 2 : 0.0;
+  }
+  while (cap2 > 0.0
+         && gateSlewDiff(drvr_port, cap2, slew, dcalc_ap, false) < 0.0) {
+    cap1 = cap2;
+    cap2 *= 2;
+  }
+  searchSlewLoadCap(drvr_port, slew, dcalc_ap, false, cap1, cap2);
+  return cap1;
+}
+
+// Binary search for the load cap between cap1 and cap2 where the slew
+// difference crosses zero.
+void RepairDesign::searchSlewLoadCap(LibertyPort* drvr_port,
+                                     double slew,
+                                     const DcalcAnalysisPt* dcalc_ap,
+                                     bool estimate,
+                                     double& cap1,
+                                     double& cap2)
+{
   double tol = .01;  // 1%
-  double diff1 = gateSlewDiff(drvr_port, cap2, slew, dcalc_ap);
+  double diff1 = gateSlewDiff(drvr_port, cap2, slew, dcalc_ap, estimate);
   // binary search for diff = 0.
   while (abs(cap1 - cap2) > max(cap1, cap2) * tol) {
     if (diff1 < 0.0) {
       cap1 = cap2;
       cap2 *= 2;
-      diff1 = gateSlewDiff(drvr_port, cap2, slew, dcalc_ap);
+      diff1 = gateSlewDiff(drvr_port, cap2, slew, dcalc_ap, estimate);
     } else {
       double cap3 = (cap1 + cap2) / 2.0;
-      double diff2 = gateSlewDiff(drvr_port, cap3, slew, dcalc_ap);
+      double diff2 = gateSlewDiff(drvr_port, cap3, slew, dcalc_ap, estimate);
       if (diff2 < 0.0) {
         cap1 = cap3;
       } else {
@@ -699,18 +728,23 @@ double RepairDesign::findSlewLoadCap(LibertyPort* drvr_port,
       }
     }
   }
-  return cap1;
 }
 
 // objective function
 double RepairDesign::gateSlewDiff(LibertyPort* drvr_port,
                                   double load_cap,
                                   double slew,
-                                  const DcalcAnalysisPt* dcalc_ap)
+                                  const DcalcAnalysisPt* dcalc_ap,
+                                  bool estimate)
 {
   ArcDelay delays[RiseFall::index_count];
   Slew slews[RiseFall::index_count];
-  resizer_->gateDelays(drvr_port, load_cap, dcalc_ap, delays, slews);
+  if (estimate) {
+    resizer_->gate_delay_cache_->gateDelays(
+        drvr_port, load_cap, dcalc_ap, delays, slews);
+  } else {
+    resizer_->gateDelays(drvr_port, load_cap, dcalc_ap, delays, slews);
+  }
   Slew gate_slew
       = max(slews[RiseFall::riseIndex()], slews[RiseFall::fallIndex()]);
   return gate_slew - slew;
@@ -181,10 +181,18 @@ class RepairDesign : dbStaState
   double findSlewLoadCap(LibertyPort* drvr_port,
                          double slew,
                          const Corner* corner);
+  void searchSlewLoadCap(LibertyPort* drvr_port,
+                         double slew,
+                         const DcalcAnalysisPt* dcalc_ap,
+                         bool estimate,
+                         double& cap1,
+                         double& cap2);
+  // estimate interpolates the slew from GateDelayCache.
   double gateSlewDiff(LibertyPort* drvr_port,
                       double load_cap,
                       double slew,
-                      const DcalcAnalysisPt* dcalc_ap);
+                      const DcalcAnalysisPt* dcalc_ap,
+                      bool estimate);
   LoadRegion findLoadRegions(const Pin* drvr_pin, int max_fanout);
   void subdivideRegion(LoadRegion& region, int max_fanout);
   void makeRegionRepeaters(LoadRegion& region,
@@ -90,7 +90,8 @@ void RepairHold::repairHold(
     // Max buffer count as percent of design instance count.
     const float max_buffer_percent,
     const int max_passes,
-    const bool verbose)
+    const bool verbose,
+    const int batch_endpoints)
 {
   init();
   sta_->checkSlewLimitPreamble();
@@ -116,7 +117,8 @@ void RepairHold::repairHold(
              allow_setup_violations,
              max_buffer_count,
              max_passes,
-             verbose);
+             verbose,
+             batch_endpoints);
 
   // Leave the parasitices up to date.
   resizer_->updateParasitics();
@@ -150,7 +152,8 @@ void RepairHold::repairHold(const Pin* end_pin,
              allow_setup_violations,
              max_buffer_count,
              max_passes,
-             false);
+             false,
+             1);
   // Leave the parasitices up to date.
   resizer_->updateParasitics();
   resizer_->incrementalParasiticsEnd();
@@ -243,7 +246,8 @@ void RepairHold::repairHold(VertexSeq& ends,
                             const bool allow_setup_violations,
                             const int max_buffer_count,
                             const int max_passes,
-                            const bool verbose)
+                            const bool verbose,
+                            const int batch_endpoints)
 {
   // Find endpoints with hold violations.
   VertexSeq hold_failures;
@@ -280,7 +284,8 @@ void RepairHold::repairHold(VertexSeq& ends,
                      setup_margin,
                      hold_margin,
                      allow_setup_violations,
-                     max_buffer_count);
+                     max_buffer_count,
+                     batch_endpoints);
       debugPrint(logger_,
                  RSZ,
                  "repair_hold",
@@ -352,30 +357,165 @@ void RepairHold::repairHoldPass(VertexSeq& hold_failures,
                                 const double setup_margin,
                                 const double hold_margin,
                                 const bool allow_setup_violations,
-                                const int max_buffer_count)
+                                const int max_buffer_count,
+                                const int batch_endpoints)
 {
   resizer_->updateParasitics();
   sort(hold_failures, [=](Vertex* end1, Vertex* end2) {
     return sta_->vertexSlack(end1, min_) < sta_->vertexSlack(end2, min_);
   });
+  if (batch_endpoints > 1) {
+    repairHoldRounds(hold_failures,
+                     buffer_cell,
+                     setup_margin,
+                     hold_margin,
+                     allow_setup_violations,
+                     max_buffer_count,
+                     batch_endpoints);
+    return;
+  }
   for (Vertex* end_vertex : hold_failures) {
     resizer_->updateParasitics();
     repairEndHold(end_vertex,
                   buffer_cell,
                   setup_margin,
                   hold_margin,
-                  allow_setup_violations);
+                  allow_setup_violations,
+                  nullptr);
     if (inserted_buffer_count_ > max_buffer_count) {
       break;
     }
   }
 }
 
+// Repair the hold failures in rounds of up to batch_endpoints ends whose
+// worst hold paths share no instances. Ends that conflict with their
+// round are put off to a later sweep.
+void RepairHold::repairHoldRounds(VertexSeq& hold_failures,
+                                  LibertyCell* buffer_cell,
+                                  const double setup_margin,
+                                  const double hold_margin,
+                                  const bool allow_setup_violations,
+                                  const int max_buffer_count,
+                                  const int batch_endpoints)
+{
+  VertexSeq pending = hold_failures;
+  while (!pending.empty() && inserted_buffer_count_ <= max_buffer_count) {
+    VertexSeq deferred;
+    auto next = pending.begin();
+    while (next != pending.end()
+           && inserted_buffer_count_ <= max_buffer_count) {
+      next = repairHoldRound(next,
+                             pending.end(),
+                             deferred,
+                             buffer_cell,
+                             setup_margin,
+                             hold_margin,
+                             allow_setup_violations,
+                             max_buffer_count,
+                             batch_endpoints);
+    }
+    pending = std::move(deferred);
+  }
+}
+
+// Insert the hold buffers for a round of ends taken from [begin, end) and
+// check setup timing and the buffered drivers' slews once for the whole
+// round. Each end's worst path is queried after the parasitics of the
+// buffers already inserted in the round are updated, so it is never a
+// path from before an insertion it depends on. If the round degrades
+// setup or a buffer slows its driver too much it is undone and the ends
+// are repaired one at a time with a check per buffer. Returns the first
+// end not taken.
+VertexSeq::iterator RepairHold::repairHoldRound(
+    VertexSeq::iterator begin,
+    VertexSeq::iterator end,
+    VertexSeq& deferred,
+    LibertyCell* buffer_cell,
+    const double setup_margin,
+    const double hold_margin,
+    const bool allow_setup_violations,
+    const int max_buffer_count,
+    const int batch_endpoints)
+{
+  resizer_->journalBegin();
+  const Slack setup_slack_before = sta_->worstSlack(max_);
+  VertexSeq round;
+  std::unordered_set<const sta::Instance*> round_insts;
+  vector<std::pair<Vertex*, Slew>> driver_slews;
+  int updated_buffer_count = inserted_buffer_count_;
+  auto next = begin;
+  for (; next != end && round.size() < static_cast<size_t>(batch_endpoints)
+         && inserted_buffer_count_ <= max_buffer_count;
+       ++next) {
+    Vertex* end_vertex = *next;
+    if (inserted_buffer_count_ > updated_buffer_count) {
+      resizer_->updateParasitics();
+      updated_buffer_count = inserted_buffer_count_;
+    }
+    PathRef end_path = sta_->vertexWorstSlackPath(end_vertex, min_);
+    if (!end_path.isNull()
+        && !resizer_->addPathInsts(end_path, round_insts)) {
+      deferred.push_back(end_vertex);
+      continue;
+    }
+    round.push_back(end_vertex);
+    repairEndHold(end_vertex,
+                  buffer_cell,
+                  setup_margin,
+                  hold_margin,
+                  allow_setup_violations,
+                  &driver_slews);
+  }
+  resizer_->updateParasitics();
+  const Slack setup_slack_after = sta_->worstSlack(max_);
+  bool slews_ok = true;
+  for (const auto& [drvr_vertex, slew_before] : driver_slews) {
+    const Slew slew_after = sta_->vertexSlew(drvr_vertex, max_);
+    if (slew_before > 0 && slew_after / slew_before > hold_slew_factor_max_) {
+      slews_ok = false;
+      break;
+    }
+  }
+  const bool restore = !slews_ok
+                       || (!allow_setup_violations
+                           && fuzzyLess(setup_slack_after, setup_slack_before)
+                           && setup_slack_after < setup_margin);
+  debugPrint(logger_,
+             RSZ,
+             "repair_hold",
+             2,
+             "round of {} ends setup slack {} -> {} {}",
+             round.size(),
+             delayAsString(setup_slack_before, sta_, 3),
+             delayAsString(setup_slack_after, sta_, 3),
+             restore ? "restore" : "save");
+  if (restore) {
+    resizer_->journalRestore(
+        resize_count_, inserted_buffer_count_, cloned_gate_count_);
+  }
+  resizer_->journalEnd();
+  if (restore) {
+    for (Vertex* end_vertex : round) {
+      resizer_->updateParasitics();
+      repairEndHold(end_vertex,
+                    buffer_cell,
+                    setup_margin,
+                    hold_margin,
+                    allow_setup_violations,
+                    nullptr);
+    }
+    resizer_->updateParasitics();
+  }
+  return next;
+}
+
 void RepairHold::repairEndHold(Vertex* end_vertex,
                                LibertyCell* buffer_cell,
                                const double setup_margin,
                                const double hold_margin,
-                               const bool allow_setup_violations)
+                               const bool allow_setup_violations,
+                               vector<std::pair<Vertex*, Slew>>* driver_slews)
 {
   PathRef end_path = sta_->vertexWorstSlackPath(end_vertex, min_);
   if (!end_path.isNull()) {
@@ -468,6 +608,18 @@ void RepairHold::repairEndHold(Vertex* end_vertex,
               Point drvr_loc = db_network_->location(path_vertex->pin());
               Point buffer_loc((drvr_loc.x() + path_load_loc.x()) / 2,
                                (drvr_loc.y() + path_load_loc.y()) / 2);
+              if (driver_slews) {
+                // The caller checks setup and the driver slews after a
+                // round of buffers.
+                const Slew slew_before = sta_->vertexSlew(path_vertex, max_);
+                makeHoldDelay(path_vertex,
+                              load_pins,
+                              loads_have_out_port,
+                              buffer_cell,
+                              buffer_loc);
+                driver_slews->emplace_back(path_vertex, slew_before);
+                continue;
+              }
               // Despite checking for setup slack to insert the bufffer,
               // increased slews downstream can increase delays and
               // reduce setup slack in ways that are too expensive to
@@ -486,7 +638,7 @@ void RepairHold::repairEndHold(Vertex* end_vertex,
               float slew_factor
                   = (slew_before > 0) ? slew_after / slew_before : 1.0;
 
-              if (slew_factor > 1.20
+              if (slew_factor > hold_slew_factor_max_
                   || (!allow_setup_violations
                       && fuzzyLess(setup_slack_after, setup_slack_before)
                       && setup_slack_after < setup_margin)) {
@@ -35,6 +35,10 @@
 
 #pragma once
 
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
 #include "db_sta/dbSta.hh"
 #include "sta/MinMax.hh"
 #include "sta/StaState.hh"
@@ -73,7 +77,8 @@ class RepairHold : public sta::dbStaState
                   // Max buffer count as percent of design instance count.
                   float max_buffer_percent,
                   int max_passes,
-                  bool verbose);
+                  bool verbose,
+                  int batch_endpoints);
   void repairHold(const Pin* end_pin,
                   double setup_margin,
                   double hold_margin,
@@ -101,18 +106,40 @@ class RepairHold : public sta::dbStaState
                   bool allow_setup_violations,
                   int max_buffer_count,
                   int max_passes,
-                  bool verbose);
+                  bool verbose,
+                  int batch_endpoints);
   void repairHoldPass(VertexSeq& hold_failures,
                       LibertyCell* buffer_cell,
                       double setup_margin,
                       double hold_margin,
                       bool allow_setup_violations,
-                      int max_buffer_count);
+                      int max_buffer_count,
+                      int batch_endpoints);
+  void repairHoldRounds(VertexSeq& hold_failures,
+                        LibertyCell* buffer_cell,
+                        double setup_margin,
+                        double hold_margin,
+                        bool allow_setup_violations,
+                        int max_buffer_count,
+                        int batch_endpoints);
+  VertexSeq::iterator repairHoldRound(VertexSeq::iterator begin,
+                                      VertexSeq::iterator end,
+                                      VertexSeq& deferred,
+                                      LibertyCell* buffer_cell,
+                                      double setup_margin,
+                                      double hold_margin,
+                                      bool allow_setup_violations,
+                                      int max_buffer_count,
+                                      int batch_endpoints);
+  // If driver_slews is null the setup slack and slew of every inserted
+  // buffer are checked as it is inserted. Otherwise the caller checks
+  // them, and each buffered driver is added with its slew before buffering.
   void repairEndHold(Vertex* end_vertex,
                      LibertyCell* buffer_cell,
                      double setup_margin,
                      double hold_margin,
-                     bool allow_setup_violations);
+                     bool allow_setup_violations,
+                     std::vector<std::pair<Vertex*, sta::Slew>>* driver_slews);
   void makeHoldDelay(Vertex* drvr,
                      PinSeq& load_pins,
                      bool loads_have_out_port,
@@ -139,6 +166,8 @@ class RepairHold : public sta::dbStaState
   const int fall_index_ = RiseFall::fallIndex();
 
   static constexpr float hold_slack_limit_ratio_max_ = 0.2;
+  // Max increase in a driver's slew from inserting a hold buffer.
+  static constexpr float hold_slew_factor_max_ = 1.20;
   static constexpr int print_interval_ = 10;
 };
 
@@ -89,7 +89,8 @@ void RepairSetup::repairSetup(const float setup_slack_margin,
                               const bool verbose,
                               const bool skip_pin_swap,
                               const bool skip_gate_cloning,
-                              const bool skip_buffer_removal)
+                              const bool skip_buffer_removal,
+                              const int batch_endpoints)
 {
   init();
   constexpr int digits = 3;
@@ -154,8 +155,21 @@ void RepairSetup::repairSetup(const float setup_slack_margin,
   if (verbose) {
     printProgress(print_iteration, false, false);
   }
+  int batch_end_index = 0;
   for (const auto& end_original_slack : violating_ends) {
     Vertex* end = end_original_slack.first;
+    // Ends after the worst one are first repaired in batches when requested.
+    if (batch_endpoints > 1 && end_index > 0 && end_index >= batch_end_index
+        && end_index < max_end_count) {
+      batch_end_index = repairEndpointBatch(violating_ends,
+                                            end_index,
+                                            max_end_count,
+                                            batch_endpoints,
+                                            setup_slack_margin,
+                                            skip_pin_swap,
+                                            skip_gate_cloning,
+                                            skip_buffer_removal);
+    }
     Slack end_slack = sta_->vertexSlack(end, max_);
     Slack worst_slack;
     Vertex* worst_vertex;
@@ -520,6 +534,96 @@ bool RepairSetup::repairPath(PathRef& path,
   return changed;
 }
 
+// Repair the worst paths of a batch of violating ends with one move each
+// and a single timing check for the whole batch.  Paths that share an
+// instance with an earlier path in the batch are left to the serial
+// repair.  Disjoint paths can still share a net driven by a top level
+// port, and a move updates timing in its fanout cone, so each end's slack
+// and worst path are queried again after the previous move rather than
+// reused from before the batch.
+// The batch is undone if it makes the worst slack or the total slack of
+// its ends worse. Returns the index of the first end after the batch.
+int RepairSetup::repairEndpointBatch(
+    const vector<pair<Vertex*, Slack>>& violating_ends,
+    const int begin,
+    const int end,
+    const int batch_endpoints,
+    const float setup_slack_margin,
+    const bool skip_pin_swap,
+    const bool skip_gate_cloning,
+    const bool skip_buffer_removal)
+{
+  const Slack prev_worst_slack = sta_->worstSlack(max_);
+  std::unordered_set<const sta::Instance*> path_insts;
+  vector<pair<Vertex*, Slack>> batch;
+  const size_t max_batch = batch_endpoints;
+  int index = begin;
+  for (; index < end && batch.size() < max_batch; index++) {
+    Vertex* end_vertex = violating_ends[index].first;
+    const Slack end_slack = sta_->vertexSlack(end_vertex, max_);
+    if (end_slack > setup_slack_margin) {
+      continue;
+    }
+    PathRef end_path = sta_->vertexWorstSlackPath(end_vertex, max_);
+    if (resizer_->addPathInsts(end_path, path_insts)) {
+      batch.emplace_back(end_vertex, end_slack);
+    }
+  }
+
+  vector<Vertex*> batch_ends;
+  Slack prev_batch_slack = 0.0;
+  bool moved = false;
+  resizer_->journalBegin();
+  for (const auto& [end_vertex, batch_slack] : batch) {
+    if (moved) {
+      resizer_->updateParasitics();
+    }
+    const Slack end_slack
+        = moved ? sta_->vertexSlack(end_vertex, max_) : batch_slack;
+    if (end_slack > setup_slack_margin) {
+      continue;
+    }
+    PathRef end_path = sta_->vertexWorstSlackPath(end_vertex, max_);
+    if (repairPath(end_path,
+                   end_slack,
+                   skip_pin_swap,
+                   skip_gate_cloning,
+                   skip_buffer_removal)) {
+      batch_ends.push_back(end_vertex);
+      prev_batch_slack += batch_slack;
+      moved = true;
+    }
+  }
+
+  if (!batch_ends.empty()) {
+    resizer_->updateParasitics();
+    sta_->findRequireds();
+    Slack batch_slack = 0.0;
+    for (Vertex* end_vertex : batch_ends) {
+      batch_slack += sta_->vertexSlack(end_vertex, max_);
+    }
+    const Slack worst_slack = sta_->worstSlack(max_);
+    const bool better = !fuzzyLess(worst_slack, prev_worst_slack)
+                        && fuzzyGreater(batch_slack, prev_batch_slack);
+    debugPrint(logger_,
+               RSZ,
+               "repair_setup",
+               2,
+               "batch of {} ends slack = {} worst_slack = {} {}",
+               batch_ends.size(),
+               delayAsString(batch_slack, sta_, 3),
+               delayAsString(worst_slack, sta_, 3),
+               better ? "save" : "restore");
+    if (!better) {
+      resizer_->journalRestore(
+          resize_count_, inserted_buffer_count_, cloned_gate_count_);
+      resizer_->updateParasitics();
+      sta_->findRequireds();
+    }
+  }
+  return index;
+}
+
 void RepairSetup::debugCheckMultipleBuffers(PathRef& path,
                                             PathExpanded* expanded)
 {
@@ -91,7 +91,8 @@ class RepairSetup : public sta::dbStaState
                    bool verbose,
                    bool skip_pin_swap,
                    bool skip_gate_cloning,
-                   bool skip_buffer_removal);
+                   bool skip_buffer_removal,
+                   int batch_endpoints);
   // For testing.
   void repairSetup(const Pin* end_pin);
   // For testing.
@@ -107,6 +108,14 @@ class RepairSetup : public sta::dbStaState
                   bool skip_pin_swap,
                   bool skip_gate_cloning,
                   bool skip_buffer_removal);
+  int repairEndpointBatch(const vector<pair<Vertex*, Slack>>& violating_ends,
+                          int begin,
+                          int end,
+                          int batch_endpoints,
+                          float setup_slack_margin,
+                          bool skip_pin_swap,
+                          bool skip_gate_cloning,
+                          bool skip_buffer_removal);
   void debugCheckMultipleBuffers(PathRef& path, PathExpanded* expanded);
   bool simulateExpr(
       sta::FuncExpr* expr,
@@ -186,6 +195,9 @@ class RepairSetup : public sta::dbStaState
   static constexpr int rebuffer_max_fanout_ = 20;
   static constexpr int split_load_min_fanout_ = 8;
   static constexpr double rebuffer_buffer_penalty_ = .01;
+  // Rebuffer options whose interpolated required time is within this
+  // fraction of a buffer delay of the best are compared exactly.
+  static constexpr double rebuffer_screen_margin_ = .1;
   static constexpr int print_interval_ = 10;
   static constexpr int buffer_removal_max_fanout_ = 10;
 };
@@ -41,6 +41,7 @@
 
 #include "AbstractSteinerRenderer.h"
 #include "BufferedNet.hh"
+#include "GateDelayCache.hh"
 #include "RecoverPower.hh"
 #include "RepairDesign.hh"
 #include "RepairHold.hh"
@@ -58,6 +59,8 @@
 #include "sta/Liberty.hh"
 #include "sta/Network.hh"
 #include "sta/Parasitics.hh"
+#include "sta/PathExpanded.hh"
+#include "sta/PathRef.hh"
 #include "sta/PortDirection.hh"
 #include "sta/Sdc.hh"
 #include "sta/Search.hh"
@@ -98,6 +101,7 @@ using sta::NetIterator;
 using sta::NetPinIterator;
 using sta::NetTermIterator;
 using sta::NetworkEdit;
+using sta::PathExpanded;
 using sta::Port;
 using sta::stringLess;
 using sta::Term;
@@ -130,6 +134,7 @@ Resizer::Resizer()
       repair_design_(new RepairDesign(this)),
       repair_setup_(new RepairSetup(this)),
       repair_hold_(new RepairHold(this)),
+      gate_delay_cache_(new GateDelayCache(this)),
       wire_signal_res_(0.0),
       wire_signal_cap_(0.0),
       wire_clk_res_(0.0),
@@ -143,6 +148,7 @@ Resizer::~Resizer()
   delete repair_design_;
   delete repair_setup_;
   delete repair_hold_;
+  delete gate_delay_cache_;
 }
 
 void Resizer::init(Logger* logger,
@@ -251,30 +257,34 @@ void Resizer::removeBuffers(sta::InstanceSeq insts)
   search_->arrivalsInvalid();
 
   int remove_count = 0;
-  if (insts.empty()) {
-    // remove all the buffers
-    for (dbInst* db_inst : block_->getInsts()) {
-      Instance* buffer = db_network_->dbToSta(db_inst);
-      if (removeBuffer(buffer, /* honor dont touch */ true)) {
-        remove_count++;
+  {
+    EcoScope eco(this);
+    if (insts.empty()) {
+      // remove all the buffers
+      for (dbInst* db_inst : block_->getInsts()) {
+        Instance* buffer = db_network_->dbToSta(db_inst);
+        if (removeBuffer(buffer, /* honor dont touch */ true)) {
+          remove_count++;
+        }
       }
-    }
-  } else {
-    // remove only select buffers specified by user
-    InstanceSeq::Iterator inst_iter(insts);
-    while (inst_iter.hasNext()) {
-      Instance* buffer = const_cast<Instance*>(inst_iter.next());
-      if (removeBuffer(buffer, /* don't honor dont touch */ false)) {
-        remove_count++;
-      } else {
-        logger_->warn(
-            RSZ,
-            97,
-            "Instance {} cannot be removed because it is not a buffer",
-            " or is a feedthrough port buffer",
-            db_network_->name(buffer));
+    } else {
+      // remove only select buffers specified by user
+      InstanceSeq::Iterator inst_iter(insts);
+      while (inst_iter.hasNext()) {
+        Instance* buffer = const_cast<Instance*>(inst_iter.next());
+        if (removeBuffer(buffer, /* don't honor dont touch */ false)) {
+          remove_count++;
+        } else {
+          logger_->warn(
+              RSZ,
+              97,
+              "Instance {} cannot be removed because it is not a buffer",
+              " or is a feedthrough port buffer",
+              db_network_->name(buffer));
+        }
       }
     }
+    eco.commit();
   }
   level_drvr_vertices_valid_ = false;
   logger_->info(RSZ, 26, "Removed {} buffers.", remove_count);
@@ -377,7 +387,9 @@ bool Resizer::removeBuffer(Instance* buffer, bool honorDontTouchFixed)
       parasitics_invalid_.erase(removed);
     }
     parasiticsInvalid(survivor);
-    updateParasitics();
+    if (eco_depth_ == 0) {
+      updateParasitics();
+    }
   }
   return buffer_removed;
 }
@@ -964,6 +976,9 @@ void Resizer::resizePreamble()
   checkLibertyForAllCorners();
   findBuffers();
   findTargetLoads();
+  // Libraries, corners or the target slews may have changed since the
+  // last command.
+  gate_delay_cache_->clear();
 }
 
 void Resizer::checkLibertyForAllCorners()
@@ -2151,6 +2166,20 @@ void Resizer::bufferDelays(LibertyCell* buffer_cell,
   gateDelays(output, load_cap, dcalc_ap, delays, slews);
 }
 
+float Resizer::bufferDelayEstimate(LibertyCell* buffer_cell,
+                                   const RiseFall* rf,
+                                   float load_cap,
+                                   const DcalcAnalysisPt* dcalc_ap)
+{
+  LibertyPort *input, *output;
+  buffer_cell->bufferPorts(input, output);
+  ArcDelay gate_delays[RiseFall::index_count];
+  Slew slews[RiseFall::index_count];
+  gate_delay_cache_->gateDelays(
+      output, load_cap, dcalc_ap, gate_delays, slews);
+  return gate_delays[rf->index()];
+}
+
 // Create a map of all the pins that are equivalent and then use the fastest pin
 // for our violating path. Current implementation does not handle the case
 // where 2 paths go through the same gate (we could end up swapping pins twice)
@@ -2534,6 +2563,7 @@ void Resizer::repairDesign(double max_wire_length,
   }
   repair_design_->repairDesign(
       max_wire_length, slew_margin, cap_margin, verbose);
+  gate_delay_cache_->reportStats();
 }
 
 int Resizer::repairDesignBufferCount() const
@@ -2673,7 +2703,8 @@ void Resizer::repairSetup(double setup_margin,
                           bool verbose,
                           bool skip_pin_swap,
                           bool skip_gate_cloning,
-                          bool skip_buffer_removal)
+                          bool skip_buffer_removal,
+                          int batch_endpoints)
 {
   resizePreamble();
   if (parasitics_src_ == ParasiticsSrc::global_routing) {
@@ -2685,7 +2716,9 @@ void Resizer::repairSetup(double setup_margin,
                              verbose,
                              skip_pin_swap,
                              skip_gate_cloning,
-                             skip_buffer_removal);
+                             skip_buffer_removal,
+                             batch_endpoints);
+  gate_delay_cache_->reportStats();
 }
 
 void Resizer::reportSwappablePins()
@@ -2715,7 +2748,8 @@ void Resizer::repairHold(
     // Max buffer count as percent of design instance count.
     float max_buffer_percent,
     int max_passes,
-    bool verbose)
+    bool verbose,
+    int batch_endpoints)
 {
   resizePreamble();
   if (parasitics_src_ == ParasiticsSrc::global_routing) {
@@ -2726,7 +2760,8 @@ void Resizer::repairHold(
                            allow_setup_violations,
                            max_buffer_percent,
                            max_passes,
-                           verbose);
+                           verbose,
+                           batch_endpoints);
 }
 
 void Resizer::repairHold(const Pin* end_pin,
@@ -2761,6 +2796,25 @@ void Resizer::recoverPower(float recover_power_percent)
 }
 ////////////////////////////////////////////////////////////////
 // Journal to roll back changes (OpenDB not up to the task).
+bool Resizer::addPathInsts(PathRef& path,
+                           std::unordered_set<const Instance*>& path_insts)
+{
+  PathExpanded expanded(&path, sta_);
+  std::vector<const Instance*> insts;
+  for (int i = expanded.startIndex(); i < expanded.size(); i++) {
+    const Pin* pin = expanded.path(i)->pin(sta_);
+    if (!network_->isTopLevelPort(pin)) {
+      const Instance* inst = network_->instance(pin);
+      if (path_insts.find(inst) != path_insts.end()) {
+        return false;
+      }
+      insts.push_back(inst);
+    }
+  }
+  path_insts.insert(insts.begin(), insts.end());
+  return true;
+}
+
 void Resizer::journalBegin()
 {
   debugPrint(logger_, RSZ, "journal", 1, "journal begin");
@@ -2949,17 +3003,21 @@ void Resizer::journalRestore(int& resize_count,
   }
   inserted_buffer_set_.clear();
 
-  while (!inserted_buffers_.empty()) {
-    const Instance* buffer = inserted_buffers_.back();
-    debugPrint(logger_,
-               RSZ,
-               "journal",
-               1,
-               "journal remove buffer {}",
-               network_->pathName(buffer));
-    removeBuffer(const_cast<Instance*>(buffer));
-    inserted_buffers_.pop_back();
-    inserted_buffer_count--;
+  {
+    EcoScope eco(this);
+    while (!inserted_buffers_.empty()) {
+      const Instance* buffer = inserted_buffers_.back();
+      debugPrint(logger_,
+                 RSZ,
+                 "journal",
+                 1,
+                 "journal remove buffer {}",
+                 network_->pathName(buffer));
+      removeBuffer(const_cast<Instance*>(buffer));
+      inserted_buffers_.pop_back();
+      inserted_buffer_count--;
+    }
+    eco.commit();
   }
 
   // Undo pin swaps
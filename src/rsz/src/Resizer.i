@@ -550,14 +550,15 @@ repair_setup(double setup_margin,
              int max_passes,
              bool verbose,
              bool skip_pin_swap, bool skip_gate_cloning,
-             bool enable_buffer_removal)
+             bool enable_buffer_removal,
+             int batch_endpoints)
 {
   ensureLinked();
   Resizer *resizer = getResizer();
   resizer->repairSetup(setup_margin, repair_tns_end_percent,
                        max_passes, verbose,
                        skip_pin_swap, skip_gate_cloning,
-                       !enable_buffer_removal);
+                       !enable_buffer_removal, batch_endpoints);
 }
 
 void
@@ -582,14 +583,15 @@ repair_hold(double setup_margin,
             bool allow_setup_violations,
             float max_buffer_percent,
             int max_passes,
-            bool verbose)
+            bool verbose,
+            int batch_endpoints)
 {
   ensureLinked();
   Resizer *resizer = getResizer();
   resizer->repairHold(setup_margin, hold_margin,
                       allow_setup_violations,
                       max_buffer_percent, max_passes,
-                      verbose);
+                      verbose, batch_endpoints);
 }
 
 void
@@ -521,6 +521,7 @@ sta::define_cmd_args "repair_timing" {[-setup] [-hold]\
                                         [-skip_gate_cloning]\
                                         [-enable_buffer_removal]\
                                         [-repair_tns tns_end_percent]\
+                                        [-batch_endpoints count]\
                                         [-max_passes passes]\
                                         [-max_buffer_percent buffer_percent]\
                                         [-max_utilization util] \
@@ -530,7 +531,7 @@ proc repair_timing { args } {
   sta::parse_key_args "repair_timing" args \
     keys {-setup_margin -hold_margin -slack_margin \
             -libraries -max_utilization -max_buffer_percent \
-            -recover_power -repair_tns -max_passes} \
+            -recover_power -repair_tns -batch_endpoints -max_passes} \
     flags {-setup -hold -allow_setup_violations -skip_pin_swap -skip_gate_cloning \
             -enable_buffer_removal -verbose}
 
@@ -576,6 +577,12 @@ proc repair_timing { args } {
     set repair_tns_end_percent [expr $repair_tns_end_percent / 100.0]
   }
 
+  set batch_endpoints 1
+  if { [info exists keys(-batch_endpoints)] } {
+    set batch_endpoints $keys(-batch_endpoints)
+    sta::check_positive_integer "-batch_endpoints" $batch_endpoints
+  }
+
   set recover_power_percent -1
   if { [info exists keys(-recover_power)] } {
     set recover_power_percent $keys(-recover_power)
@@ -600,12 +607,13 @@ proc repair_timing { args } {
     if { $setup } {
       rsz::repair_setup $setup_margin $repair_tns_end_percent $max_passes \
         $verbose \
-        $skip_pin_swap $skip_gate_cloning $enable_buffer_removal
+        $skip_pin_swap $skip_gate_cloning $enable_buffer_removal \
+        $batch_endpoints
     }
     if { $hold } {
       rsz::repair_hold $setup_margin $hold_margin \
         $allow_setup_violations $max_buffer_percent $max_passes \
-        $verbose
+        $verbose $batch_endpoints
     }
   }
 }
@@ -117,4 +117,5 @@ record_tests {
 
 record_pass_fail_tests {
   cpp_tests
+  repair_setup_batch1
 }
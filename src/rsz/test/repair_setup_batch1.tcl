@@ -0,0 +1,39 @@
+# repair_timing -setup -batch_endpoints with batch paths through a shared net
+source "helpers.tcl"
+read_liberty Nangate45/Nangate45_typ.lib
+read_lef Nangate45/Nangate45.lef
+read_def repair_setup_batch1.def
+create_clock -period 0.3 clk
+set_input_delay -clock clk 0.05 in1
+
+source Nangate45/Nangate45.rc
+set_wire_rc -layer metal3
+estimate_parasitics -placement
+
+# The paths to rb and rc share no instance, so they are repaired in one
+# batch, but both are loaded by the in1 net.  The move on the first changes
+# the load on in1 and must not leave the second repaired from a stale path.
+set worst_before [worst_slack -max]
+set tns_before [total_negative_slack -max]
+repair_timing -setup -repair_tns 100 -batch_endpoints 2
+set worst_after [worst_slack -max]
+set tns_after [total_negative_slack -max]
+
+if { $worst_after < $worst_before } {
+  puts "fail - worst slack $worst_after is below $worst_before"
+  exit 1
+}
+if { $tns_after <= $tns_before } {
+  puts "fail - total negative slack $tns_after did not improve on $tns_before"
+  exit 1
+}
+foreach reg {ra rb rc} {
+  set pin [get_pins $reg/D]
+  if { [get_nets -of_objects $pin] == "" } {
+    puts "fail - $reg/D is disconnected"
+    exit 1
+  }
+}
+
+puts "pass"
+exit
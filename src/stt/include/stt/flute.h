@@ -59,6 +59,9 @@ using stt::Tree;
 // User-Callable Functions
 // Delete LUT tables for exit so they are not leaked.
 void deleteLUT();
+// Build the LUT tables for every degree. They are otherwise built on first
+// use, so call this before calling flute from multiple threads.
+void initAllLUT();
 int flute_wl(int d,
              const std::vector<int>& x,
              const std::vector<int>& y,
@@ -79,8 +79,10 @@ Tree SteinerTreeBuilder::makeSteinerTree(odb::dbNet* net,
   int min_fanout = min_fanout_alpha_.first;
   int min_hpwl = min_hpwl_alpha_.first;
 
-  if (net_alpha_map_.find(net) != net_alpha_map_.end()) {
-    net_alpha = net_alpha_map_[net];
+  // Only find() here, makeSteinerTree is called from several threads.
+  const auto net_alpha_itr = net_alpha_map_.find(net);
+  if (net_alpha_itr != net_alpha_map_.end()) {
+    net_alpha = net_alpha_itr->second;
   } else if (min_hpwl > 0) {
     if (computeHPWL(net) >= min_hpwl) {
       net_alpha = min_hpwl_alpha_.second;
@@ -258,6 +258,11 @@ void deleteLUT()
   deleteLUT(LUT, numsoln);
 }
 
+void initAllLUT()
+{
+  ensureLUT(FLUTE_D);
+}
+
 static void deleteLUT(LUT_TYPE& LUT, NUMSOLN_TYPE& numsoln)
 {
   if (LUT) {